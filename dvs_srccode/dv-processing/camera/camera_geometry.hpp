@@ -11,6 +11,9 @@
 #include <opencv2/core/eigen.hpp>
 
 #include <cmath>
+#include <limits>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 namespace dv::camera {
@@ -76,34 +79,78 @@ static std::string distortionModelToString(const DistortionModel &model) {
 class CameraGeometry {
 private:
 	/**
-	 * Row-based distortion look-up table. Access index by:
+	 * Row-based look-up table of 2D coordinates in structure-of-arrays layout, coordinate components are stored in
+	 * separate contiguous arrays so batch operations can gather and process them with vector instructions.
+	 * Access index by:
+	 * index = (y * width) + x
+	 */
+	struct CoordinateLUT {
+		std::vector<float> x;
+		std::vector<float> y;
+
+		void reserve(const size_t size) {
+			x.reserve(size);
+			y.reserve(size);
+		}
+
+		void push_back(const float xValue, const float yValue) {
+			x.push_back(xValue);
+			y.push_back(yValue);
+		}
+
+		[[nodiscard]] bool empty() const {
+			return x.empty();
+		}
+	};
+
+	/**
+	 * Value in the packed event undistortion look-up table for pixels that are undistorted out of bounds.
+	 */
+	static constexpr uint32_t InvalidPixel = std::numeric_limits<uint32_t>::max();
+
+	/**
+	 * Row-based distortion look-up table, contains undistorted unit rays, z coordinate is always 1.
+	 * Access index by:
 	 * index = (y * width) + x
 	 */
-	std::vector<cv::Point3f> mDistortionLUT;
+	CoordinateLUT mDistortionLUT;
 
 	/**
-	 * Row-based distortion look-up table. Access index by:
+	 * Row-based back projection look-up table, contains unit rays, z coordinate is always 1.
+	 * Access index by:
 	 * index = (y * width) + x
 	 */
-	std::vector<cv::Point3f> mBackProjectLUT;
+	CoordinateLUT mBackProjectLUT;
 
 	/**
 	 * Row-based undistorted coordinate look-up table, containing undistorted points in pixel space.
 	 * Access index by:
 	 * index = (y * width) + x
 	 */
-	std::vector<cv::Point2f> mDistortionPixelLUT;
+	CoordinateLUT mDistortionPixelLUT;
+
+	/**
+	 * Row-based undistorted integer pixel coordinate look-up table used for event undistortion. Coordinates are
+	 * packed as (y << 16) | x, pixels that are undistorted out of bounds contain `InvalidPixel`.
+	 * Access index by:
+	 * index = (y * width) + x
+	 */
+	std::vector<uint32_t> mUndistortEventLUT;
 
 	/**
 	 * Generates internal distortion look-up table to speed up undistortion.
 	 */
 	void generateLUTs() {
+		const auto size = static_cast<size_t>(mResolution.area());
 		std::vector<cv::Point2f> allPixels;
+		allPixels.reserve(size);
+		mBackProjectLUT.reserve(size);
 		for (int y = 0.f; y < mResolution.height; y++) {
 			for (int x = 0.f; x < mResolution.width; x++) {
 				allPixels.emplace_back(static_cast<float>(x), static_cast<float>(y));
-				mBackProjectLUT.push_back(
-					backProject<cv::Point3f, cv::Point2f, FunctionImplementation::SubPixel>(allPixels.back()));
+				const auto ray
+					= backProject<cv::Point3f, cv::Point2f, FunctionImplementation::SubPixel>(allPixels.back());
+				mBackProjectLUT.push_back(ray.x, ray.y);
 			}
 		}
 		if (!mDistortion.empty()) {
@@ -111,16 +158,10 @@ private:
 			switch (mDistortionModel) {
 				case DistortionModel::RadTan: {
 					cv::undistortPoints(allPixels, undistortedPixels, getCameraMatrix(), mDistortion);
-					for (const auto &p : undistortedPixels) {
-						mDistortionLUT.emplace_back(p.x, p.y, 1.f);
-					}
 					break;
 				}
 				case DistortionModel::Equidistant: {
 					cv::fisheye::undistortPoints(allPixels, undistortedPixels, getCameraMatrix(), mDistortion);
-					for (const auto &p : undistortedPixels) {
-						mDistortionLUT.emplace_back(p.x, p.y, 1.f);
-					}
 					break;
 				}
 				case DistortionModel::None: {
@@ -131,7 +172,72 @@ private:
 						"Invalid distortion model", mDistortionModel);
 			}
 
-			mDistortionPixelLUT = projectSequence<std::vector<cv::Point2f>>(mDistortionLUT, false);
+			mDistortionLUT.reserve(undistortedPixels.size());
+			for (const auto &p : undistortedPixels) {
+				mDistortionLUT.push_back(p.x, p.y);
+			}
+
+			mDistortionPixelLUT.x.resize(mDistortionLUT.x.size());
+			mDistortionPixelLUT.y.resize(mDistortionLUT.y.size());
+			projectBatch(mDistortionLUT.x, mDistortionLUT.y, mDistortionPixelLUT.x, mDistortionPixelLUT.y);
+
+			// Integer coordinates are truncated the same way as `undistort<cv::Point2i>()` does
+			mUndistortEventLUT.reserve(mDistortionPixelLUT.x.size());
+			for (size_t i = 0; i < mDistortionPixelLUT.x.size(); i++) {
+				const cv::Point2i point(static_cast<int>(mDistortionPixelLUT.x[i]),
+					static_cast<int>(mDistortionPixelLUT.y[i]));
+				mUndistortEventLUT.push_back(isWithinDimensions(point)
+												 ? (static_cast<uint32_t>(point.y) << 16) | static_cast<uint32_t>(point.x)
+												 : InvalidPixel);
+			}
+		}
+	}
+
+	/**
+	 * Compute the row-based look-up table address of pixel coordinates.
+	 */
+	template<typename Scalar>
+	[[nodiscard]] inline size_t lutAddress(const Scalar x, const Scalar y) const {
+		return static_cast<size_t>((static_cast<int32_t>(y) * mResolution.width) + static_cast<int32_t>(x));
+	}
+
+	/**
+	 * Gather coordinates of a batch of pixels from a look-up table.
+	 */
+	template<typename Scalar>
+	void gatherBatch(const CoordinateLUT &lut, const std::span<const Scalar> x, const std::span<const Scalar> y,
+		const std::span<float> outputX, const std::span<float> outputY) const {
+		validateBatchSize(x.size(), y.size(), outputX.size(), outputY.size());
+		const float *lutX = lut.x.data();
+		const float *lutY = lut.y.data();
+		for (size_t i = 0; i < x.size(); i++) {
+			const size_t address = lutAddress(x[i], y[i]);
+			outputX[i]           = lutX[address];
+			outputY[i]           = lutY[address];
+		}
+	}
+
+	/**
+	 * Gather coordinates of all events from a look-up table.
+	 */
+	void gatherEvents(const CoordinateLUT &lut, const dv::EventStore &events, const std::span<float> outputX,
+		const std::span<float> outputY) const {
+		validateBatchSize(events.size(), events.size(), outputX.size(), outputY.size());
+		const float *lutX = lut.x.data();
+		const float *lutY = lut.y.data();
+		size_t i          = 0;
+		for (const auto &event : events) {
+			const size_t address = lutAddress(event.x(), event.y());
+			outputX[i]           = lutX[address];
+			outputY[i]           = lutY[address];
+			i++;
+		}
+	}
+
+	static void validateBatchSize(const size_t inputX, const size_t inputY, const size_t outputX, const size_t outputY) {
+		if (inputX != inputY || inputX != outputX || inputX != outputY) {
+			throw dv::exceptions::InvalidArgument<size_t>(
+				"Batch input and output coordinate arrays must have the same size.", outputX);
 		}
 	}
 
@@ -362,15 +468,12 @@ public:
 		dv::runtime_assert(isWithinDimensions(point), "Undistortion coordinates are out of bounds");
 		size_t address;
 		if constexpr (concepts::Coordinate2DMembers<Input>) {
-			address = static_cast<size_t>(
-				(static_cast<int32_t>(point.y) * mResolution.width) + static_cast<int32_t>(point.x));
+			address = lutAddress(point.x, point.y);
 		}
 		else if constexpr (concepts::Coordinate2DAccessors<Input>) {
-			address = static_cast<size_t>(
-				(static_cast<int32_t>(point.y()) * mResolution.width) + static_cast<int32_t>(point.x()));
+			address = lutAddress(point.x(), point.y());
 		}
-		const auto p = mDistortionPixelLUT[address];
-		return Output(p.x, p.y);
+		return Output(mDistortionPixelLUT.x[address], mDistortionPixelLUT.y[address]);
 	}
 
 	/**
@@ -384,15 +487,40 @@ public:
 				"Trying to undistort events with a camera geometry without distortion coefficients");
 		}
 
-		dv::EventStore output;
+		auto output = std::make_shared<dv::EventPacket>();
+		output->elements.reserve(events.size());
 		for (const auto &event : events) {
-			if (const auto point = undistort<cv::Point2i>(event); isWithinDimensions(point)) {
-				output.emplace_back(
-					event.timestamp(), static_cast<int16_t>(point.x), static_cast<int16_t>(point.y), event.polarity());
+			if (const uint32_t packed = mUndistortEventLUT[lutAddress(event.x(), event.y())]; packed != InvalidPixel) {
+				output->elements.emplace_back(event.timestamp(), static_cast<int16_t>(packed & 0xFFFFU),
+					static_cast<int16_t>(packed >> 16), event.polarity());
 			}
 		}
 
-		return output;
+		if (output->elements.empty()) {
+			return {};
+		}
+		return dv::EventStore(std::shared_ptr<const dv::EventPacket>(std::move(output)));
+	}
+
+	/**
+	 * Undistort a batch of pixel coordinates given in structure-of-arrays layout, this is a pure look-up table
+	 * gather without any per-point branching.
+	 *
+	 * WARNING: Does not perform range checking!
+	 * @param x             Input pixel x coordinates.
+	 * @param y             Input pixel y coordinates.
+	 * @param undistortedX  Output undistorted pixel x coordinates, must have the same size as input.
+	 * @param undistortedY  Output undistorted pixel y coordinates, must have the same size as input.
+	 */
+	template<typename Scalar>
+	requires std::is_arithmetic_v<Scalar>
+	void undistortBatch(const std::span<const Scalar> x, const std::span<const Scalar> y,
+		const std::span<float> undistortedX, const std::span<float> undistortedY) const {
+		if (mDistortionLUT.empty()) {
+			throw std::domain_error(
+				"Trying to undistort points with a camera geometry without distortion coefficients");
+		}
+		gatherBatch(mDistortionPixelLUT, x, y, undistortedX, undistortedY);
 	}
 
 	/**
@@ -473,15 +601,13 @@ public:
 		if constexpr (implementation == FunctionImplementation::LUT) {
 			if constexpr (concepts::Coordinate2DMembers<Input>) {
 				dv::runtime_assert(isWithinDimensions(pixel), "Back projection with out-of-bounds pixel coordinates.");
-				const cv::Point3f &p = mBackProjectLUT[static_cast<size_t>(
-					(static_cast<int>(pixel.y) * mResolution.width) + static_cast<int>(pixel.x))];
-				return Output(p.x, p.y, p.z);
+				const size_t address = lutAddress(pixel.x, pixel.y);
+				return Output(mBackProjectLUT.x[address], mBackProjectLUT.y[address], 1.f);
 			}
 			else if constexpr (concepts::Coordinate2DAccessors<Input>) {
 				dv::runtime_assert(isWithinDimensions(pixel), "Back projection with out-of-bounds pixel coordinates.");
-				const cv::Point3f &p = mBackProjectLUT[static_cast<size_t>(
-					(static_cast<int>(pixel.y()) * mResolution.width) + static_cast<int>(pixel.x()))];
-				return Output(p.x, p.y, p.z);
+				const size_t address = lutAddress(pixel.x(), pixel.y());
+				return Output(mBackProjectLUT.x[address], mBackProjectLUT.y[address], 1.f);
 			}
 		}
 		else {
@@ -514,6 +640,34 @@ public:
 		return output;
 	}
 
+	/**
+	 * Back project a batch of pixel coordinates given in structure-of-arrays layout into unit rays using the look-up
+	 * table, z coordinate of the rays is always 1. Input coordinate values are rounded down.
+	 *
+	 * WARNING: Does not perform range checking!
+	 * @param x         Input pixel x coordinates.
+	 * @param y         Input pixel y coordinates.
+	 * @param rayX      Output ray x coordinates, must have the same size as input.
+	 * @param rayY      Output ray y coordinates, must have the same size as input.
+	 */
+	template<typename Scalar>
+	requires std::is_arithmetic_v<Scalar>
+	void backProjectBatch(const std::span<const Scalar> x, const std::span<const Scalar> y, const std::span<float> rayX,
+		const std::span<float> rayY) const {
+		gatherBatch(mBackProjectLUT, x, y, rayX, rayY);
+	}
+
+	/**
+	 * Back project coordinates of all events in an event store into unit rays using the look-up table, z coordinate
+	 * of the rays is always 1.
+	 * @param events    Input events.
+	 * @param rayX      Output ray x coordinates, must have the same size as the event store.
+	 * @param rayY      Output ray y coordinates, must have the same size as the event store.
+	 */
+	void backProjectBatch(const dv::EventStore &events, const std::span<float> rayX, const std::span<float> rayY) const {
+		gatherEvents(mBackProjectLUT, events, rayX, rayY);
+	}
+
 	/**
 	 * Returns a unit ray of given coordinates with applied back projection and undistortion.
 	 * This function uses look-up table and is designed for minimal execution speed.
@@ -530,15 +684,12 @@ public:
 		dv::runtime_assert(isWithinDimensions(pixel), "Undistortion coordinates are out of bounds");
 		size_t address;
 		if constexpr (concepts::Coordinate2DMembers<Input>) {
-			address
-				= static_cast<size_t>(pixel.y) * static_cast<size_t>(mResolution.width) + static_cast<size_t>(pixel.x);
+			address = lutAddress(pixel.x, pixel.y);
 		}
 		else if constexpr (concepts::Coordinate2DAccessors<Input>) {
-			address = static_cast<size_t>(pixel.y()) * static_cast<size_t>(mResolution.width)
-					+ static_cast<size_t>(pixel.x());
+			address = lutAddress(pixel.x(), pixel.y());
 		}
-		const auto p = mDistortionLUT[address];
-		return Output(p.x, p.y, p.z);
+		return Output(mDistortionLUT.x[address], mDistortionLUT.y[address], 1.f);
 	}
 
 	/**
@@ -560,6 +711,43 @@ public:
 		return undistorted;
 	}
 
+	/**
+	 * Undistort and back project a batch of pixel coordinates given in structure-of-arrays layout into unit rays using
+	 * the look-up table, z coordinate of the rays is always 1.
+	 *
+	 * WARNING: Does not perform range checking!
+	 * @param x         Input pixel x coordinates.
+	 * @param y         Input pixel y coordinates.
+	 * @param rayX      Output ray x coordinates, must have the same size as input.
+	 * @param rayY      Output ray y coordinates, must have the same size as input.
+	 */
+	template<typename Scalar>
+	requires std::is_arithmetic_v<Scalar>
+	void backProjectUndistortBatch(const std::span<const Scalar> x, const std::span<const Scalar> y,
+		const std::span<float> rayX, const std::span<float> rayY) const {
+		if (!isUndistortionAvailable()) {
+			throw std::domain_error(
+				"Trying to apply distortion with a camera geometry without distortion coefficients");
+		}
+		gatherBatch(mDistortionLUT, x, y, rayX, rayY);
+	}
+
+	/**
+	 * Undistort and back project coordinates of all events in an event store into unit rays using the look-up table,
+	 * z coordinate of the rays is always 1.
+	 * @param events    Input events.
+	 * @param rayX      Output ray x coordinates, must have the same size as the event store.
+	 * @param rayY      Output ray y coordinates, must have the same size as the event store.
+	 */
+	void backProjectUndistortBatch(
+		const dv::EventStore &events, const std::span<float> rayX, const std::span<float> rayY) const {
+		if (!isUndistortionAvailable()) {
+			throw std::domain_error(
+				"Trying to apply distortion with a camera geometry without distortion coefficients");
+		}
+		gatherEvents(mDistortionLUT, events, rayX, rayY);
+	}
+
 	/**
 	 * Project a 3D point into pixel plane.
 	 *
@@ -608,6 +796,125 @@ public:
 		return projected;
 	}
 
+	/**
+	 * Project a batch of unit rays (z = 1) given in structure-of-arrays layout into pixel plane with the pinhole model.
+	 * The loop is branch free and is vectorized by the compiler. Input and output arrays may alias.
+	 *
+	 * WARNING: Does not perform range checking!
+	 * @param x         Input ray x coordinates.
+	 * @param y         Input ray y coordinates.
+	 * @param pixelX    Output pixel x coordinates, must have the same size as input.
+	 * @param pixelY    Output pixel y coordinates, must have the same size as input.
+	 */
+	void projectBatch(const std::span<const float> x, const std::span<const float> y, const std::span<float> pixelX,
+		const std::span<float> pixelY) const {
+		validateBatchSize(x.size(), y.size(), pixelX.size(), pixelY.size());
+		const float fx = mFx;
+		const float fy = mFy;
+		const float cx = mCx;
+		const float cy = mCy;
+		for (size_t i = 0; i < x.size(); i++) {
+			pixelX[i] = (x[i] * fx) + cx;
+			pixelY[i] = (y[i] * fy) + cy;
+		}
+	}
+
+	/**
+	 * Project a batch of 3D points given in structure-of-arrays layout into pixel plane with the pinhole model.
+	 * The loop is branch free and is vectorized by the compiler.
+	 *
+	 * WARNING: Does not perform range checking!
+	 * @param x         Input point x coordinates.
+	 * @param y         Input point y coordinates.
+	 * @param z         Input point z coordinates.
+	 * @param pixelX    Output pixel x coordinates, must have the same size as input.
+	 * @param pixelY    Output pixel y coordinates, must have the same size as input.
+	 */
+	void projectBatch(const std::span<const float> x, const std::span<const float> y, const std::span<const float> z,
+		const std::span<float> pixelX, const std::span<float> pixelY) const {
+		validateBatchSize(x.size(), y.size(), pixelX.size(), pixelY.size());
+		validateBatchSize(x.size(), z.size(), pixelX.size(), pixelY.size());
+		const float fx = mFx;
+		const float fy = mFy;
+		const float cx = mCx;
+		const float cy = mCy;
+		for (size_t i = 0; i < x.size(); i++) {
+			const float inverseZ = 1.f / z[i];
+			pixelX[i]            = (x[i] * inverseZ * fx) + cx;
+			pixelY[i]            = (y[i] * inverseZ * fy) + cy;
+		}
+	}
+
+	/**
+	 * Apply distortion and project a batch of unit rays (z = 1) given in structure-of-arrays layout into pixel
+	 * plane. The per-model loops are branch free, so they can be vectorized by the compiler. The result is equal to
+	 * `project(distort(point))` for each point.
+	 *
+	 * WARNING: Does not perform range checking!
+	 * @param x         Input ray x coordinates.
+	 * @param y         Input ray y coordinates.
+	 * @param pixelX    Output pixel x coordinates, must have the same size as input.
+	 * @param pixelY    Output pixel y coordinates, must have the same size as input.
+	 */
+	void projectDistortBatch(const std::span<const float> x, const std::span<const float> y,
+		const std::span<float> pixelX, const std::span<float> pixelY) const {
+		if (!isUndistortionAvailable()) {
+			throw std::domain_error(
+				"Trying to apply distortion with a camera geometry without distortion coefficients");
+		}
+		validateBatchSize(x.size(), y.size(), pixelX.size(), pixelY.size());
+
+		const float fx = mFx;
+		const float fy = mFy;
+		const float cx = mCx;
+		const float cy = mCy;
+		switch (mDistortionModel) {
+			case DistortionModel::RadTan: {
+				const float k1 = mDistortion[0];
+				const float k2 = mDistortion[1];
+				const float p1 = mDistortion[2];
+				const float p2 = mDistortion[3];
+				const float k3 = mDistortion.size() == 5 ? mDistortion[4] : 0.f;
+				for (size_t i = 0; i < x.size(); i++) {
+					const float px     = x[i];
+					const float py     = y[i];
+					const float xy     = px * py;
+					const float r2     = (px * px) + (py * py);
+					const float radial = r2 * (k1 + r2 * (k2 + r2 * k3));
+					pixelX[i] = ((px + px * radial + 2.f * p1 * xy + p2 * (r2 + 2.f * px * px)) * fx) + cx;
+					pixelY[i] = ((py + py * radial + 2.f * p2 * xy + p1 * (r2 + 2.f * py * py)) * fy) + cy;
+				}
+				break;
+			}
+			case DistortionModel::Equidistant: {
+				const float k1 = mDistortion[0];
+				const float k2 = mDistortion[1];
+				const float k3 = mDistortion[2];
+				const float k4 = mDistortion[3];
+				for (size_t i = 0; i < x.size(); i++) {
+					const float px     = x[i];
+					const float py     = y[i];
+					const float r2     = (px * px) + (py * py);
+					const bool nonZero = r2 >= std::numeric_limits<float>::epsilon();
+					const float r      = std::sqrt(nonZero ? r2 : 1.f);
+					const float theta  = std::atan(r);
+					const float theta2 = theta * theta;
+					const float thetaD = theta * (1.f + theta2 * (k1 + theta2 * (k2 + theta2 * (k3 + theta2 * k4))));
+					const float scale  = nonZero ? thetaD / r : 1.f;
+					pixelX[i]          = (scale * px * fx) + cx;
+					pixelY[i]          = (scale * py * fy) + cy;
+				}
+				break;
+			}
+			case DistortionModel::None: {
+				projectBatch(x, y, pixelX, pixelY);
+				break;
+			}
+			default:
+				throw dv::exceptions::InvalidArgument<DistortionModel>("Invalid distortion model", mDistortionModel);
+		}
+	}
+
 	/**
 	 * Check whether given coordinates are within valid range.
 	 * @param point		Pixel coordinates
@@ -7,6 +7,11 @@
 
 #include <opencv2/imgproc.hpp>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
 namespace dv::camera {
 
 /**
@@ -26,7 +31,36 @@ public:
 		SubPixel
 	};
 
+	/**
+	 * Compact sparse depth sample: pixel coordinates in rectified space and depth in millimeters.
+	 */
+	struct SparseDepthPoint {
+		int16_t x;
+		int16_t y;
+		uint16_t depth;
+	};
+
 private:
+	/**
+	 * Compact look-up table entry holding pixel coordinates as 16-bit integers, half the size of `cv::Point2i`.
+	 * Entries of event remap look-up tables with coordinates falling outside of the rectified image are marked
+	 * invalid by a negative x coordinate, so the sign bit of x is the validity bit.
+	 */
+	struct CompactPoint {
+		int16_t x;
+		int16_t y;
+
+		[[nodiscard]] bool isValid() const {
+			return x >= 0;
+		}
+	};
+
+	static constexpr CompactPoint InvalidPoint{-1, -1};
+
+	/**
+	 * Image remap maps in OpenCV fixed-point format: CV_16SC2 integer coordinates and CV_16UC1 interpolation table
+	 * indices with 5 bits of sub-pixel precision per axis.
+	 */
 	cv::Mat mLeftRemap1;
 	cv::Mat mLeftRemap2;
 	cv::Mat mRightRemap1;
@@ -34,13 +68,19 @@ private:
 	cv::Mat mLeftProjection;
 	cv::Mat mRightProjection;
 
-	std::vector<uint8_t> mLeftValidMask;
-	std::vector<uint8_t> mRightValidMask;
+	/**
+	 * Row-based event remap look-up tables, invalid entries are marked with `InvalidPoint`. Access index by:
+	 * index = (y * width) + x
+	 */
+	std::vector<CompactPoint> mLeftRemapLUT;
+	std::vector<CompactPoint> mRightRemapLUT;
 
-	std::vector<cv::Point2i> mLeftRemapLUT;
-	std::vector<cv::Point2i> mRightRemapLUT;
-	std::vector<cv::Point2i> mLeftUnmapLUT;
-	std::vector<cv::Point2i> mRightUnmapLUT;
+	/**
+	 * Row-based unmap look-up tables, coordinates are saturated to 16-bit range. Access index by:
+	 * index = (y * width) + x
+	 */
+	std::vector<CompactPoint> mLeftUnmapLUT;
+	std::vector<CompactPoint> mRightUnmapLUT;
 
 	cv::Size mLeftResolution;
 	cv::Size mRightResolution;
@@ -72,37 +112,102 @@ private:
 		return coordinates;
 	}
 
-	static dv::EventStore remapEventsInternal(const dv::EventStore &events, const cv::Size &resolution,
-		const std::vector<uint8_t> &mask, const std::vector<cv::Point2i> &remapLUT) {
-		dv::EventStore output;
+	static dv::EventStore remapEventsInternal(
+		const dv::EventStore &events, const cv::Size &resolution, const std::vector<CompactPoint> &remapLUT) {
+		auto output = std::make_shared<dv::EventPacket>();
+		output->elements.reserve(events.size());
+
+		const CompactPoint *lut = remapLUT.data();
+		const auto width        = static_cast<size_t>(resolution.width);
 		for (const auto &event : events) {
-			const auto pos = static_cast<size_t>(event.y()) * static_cast<size_t>(resolution.width)
-						   + static_cast<size_t>(event.x());
-			dv::runtime_assert(pos < mask.size(), "Event coordinates are out of range");
-			if (mask[pos] == 1) {
-				const cv::Point2i &coords = remapLUT[pos];
-				output.emplace_back(event.timestamp(), coords.x, coords.y, event.polarity());
+			const auto pos = static_cast<size_t>(event.y()) * width + static_cast<size_t>(event.x());
+			dv::runtime_assert(pos < remapLUT.size(), "Event coordinates are out of range");
+			if (const CompactPoint coords = lut[pos]; coords.isValid()) {
+				output->elements.emplace_back(event.timestamp(), coords.x, coords.y, event.polarity());
 			}
 		}
-		return output;
+
+		if (output->elements.empty()) {
+			return {};
+		}
+		return dv::EventStore(std::shared_ptr<const dv::EventPacket>(std::move(output)));
+	}
+
+	/**
+	 * Number of events converted into depth by a single parallel task.
+	 */
+	static constexpr size_t DepthEventChunkSize = 4096;
+
+	/**
+	 * Number of rows processed by a single parallel task in dense disparity conversions.
+	 */
+	static constexpr int DepthRowStripeHeight = 16;
+
+	static void validateDisparity(const cv::Mat &disparity) {
+		if (disparity.type() != CV_16SC1) {
+			throw dv::exceptions::InvalidArgument<int>(
+				"Disparity map is expected to be a single channel 16-bit signed integer matrix.", disparity.type());
+		}
+	}
+
+	/**
+	 * Scale converting a raw disparity value into depth in millimeters: depth = scale / rawDisparity.
+	 */
+	[[nodiscard]] float depthScale(const float disparityScale) const {
+		return std::abs(static_cast<float>(mLeftProjection.at<double>(0, 0)) * mBaseline) * disparityScale * 1000.f;
+	}
+
+	/**
+	 * Convert a raw disparity value into depth in millimeters, rounded and saturated to 16-bit range. Non-positive
+	 * disparity values are invalid and are converted into zero depth. The conversion is branch-free, so loops over
+	 * disparity rows are vectorized by the compiler.
+	 */
+	[[nodiscard]] static uint16_t disparityToDepth(const int16_t rawDisparity, const float scale) {
+		const float disparity = static_cast<float>(rawDisparity);
+		const float depth     = std::min(scale / std::max(disparity, 1.f) + 0.5f, 65535.f);
+		return disparity > 0.f ? static_cast<uint16_t>(depth) : uint16_t{0};
+	}
+
+	/**
+	 * Number of valid depth values (positive disparity) in the given rows of a disparity map.
+	 */
+	[[nodiscard]] static size_t countValidDisparities(const cv::Mat &disparity, const int rowStart, const int rowEnd) {
+		size_t count = 0;
+		for (int y = rowStart; y < rowEnd; y++) {
+			const auto *row = disparity.ptr<int16_t>(y);
+			for (int x = 0; x < disparity.cols; x++) {
+				count += static_cast<size_t>(row[x] > 0);
+			}
+		}
+		return count;
 	}
 
 	void createLUTs(const cv::Size &resolution, const cv::Matx33f &cameraMatrix, const cv::Mat &distortion,
-		const cv::Mat &R, const cv::Mat &P, std::vector<uint8_t> &outputMask,
-		std::vector<cv::Point2i> &outputRemapLUT) const {
+		const cv::Mat &R, const cv::Mat &P, std::vector<CompactPoint> &outputRemapLUT) const {
 		std::vector<cv::Point2f> undistortEventOutputMap;
 		const std::vector<cv::Point2f> undistortEventInputMap = initCoordinateList(resolution);
 		cv::undistortPoints(undistortEventInputMap, undistortEventOutputMap, cameraMatrix, distortion, R, P);
-		std::copy(undistortEventOutputMap.begin(), undistortEventOutputMap.end(), std::back_inserter(outputRemapLUT));
 
-		for (size_t i = 0; i < outputRemapLUT.size(); ++i) {
-			const cv::Point2i &coord = outputRemapLUT[i];
+		outputRemapLUT.clear();
+		outputRemapLUT.reserve(undistortEventOutputMap.size());
+		for (const auto &point : undistortEventOutputMap) {
+			const cv::Point2i coord(cvRound(point.x), cvRound(point.y));
 			if (coord.x < 0 || coord.y < 0 || coord.x >= resolution.width || coord.y >= resolution.height) {
-				outputMask[i] = 0;
+				outputRemapLUT.push_back(InvalidPoint);
+			}
+			else {
+				outputRemapLUT.push_back({static_cast<int16_t>(coord.x), static_cast<int16_t>(coord.y)});
 			}
 		}
 	}
 
+	[[nodiscard]] static CompactPoint toCompactPoint(const cv::Point2f &point) {
+		constexpr float lowest  = static_cast<float>(std::numeric_limits<int16_t>::lowest());
+		constexpr float highest = static_cast<float>(std::numeric_limits<int16_t>::max());
+		return {static_cast<int16_t>(std::clamp(std::round(point.x), lowest, highest)),
+			static_cast<int16_t>(std::clamp(std::round(point.y), lowest, highest))};
+	}
+
 	template<concepts::Coordinate3DCostructible Output, concepts::Coordinate2D Input>
 	[[nodiscard]] Output backProject(const StereoGeometry::CameraPosition position, const Input &pixel) const {
 		double Fx;
@@ -176,24 +281,22 @@ public:
 		cv::initUndistortRectifyMap(rightCamera.getCameraMatrix(), rightCamera.getDistortion(), RN[1], mRightProjection,
 			rightCamera.getResolution(), CV_16SC2, mRightRemap1, mRightRemap2);
 
-		mLeftValidMask.resize(static_cast<size_t>(mLeftResolution.area()), 1);
-		mRightValidMask.resize(static_cast<size_t>(mRightResolution.area()), 1);
-
 		mLeftRectifierInverse  = dv::kinematics::Transformationf(0, cv::Mat::zeros(3, 1, CV_32FC1), RN[0].inv());
 		mRightRectifierInverse = dv::kinematics::Transformationf(0, cv::Mat::zeros(3, 1, CV_32FC1), RN[1].inv());
 
-		createLUTs(mLeftResolution, leftCamera.getCameraMatrix(), distLeftMat, RN[0], mLeftProjection, mLeftValidMask,
-			mLeftRemapLUT);
-		createLUTs(mRightResolution, rightCamera.getCameraMatrix(), distRightMat, RN[1], mRightProjection,
-			mRightValidMask, mRightRemapLUT);
+		createLUTs(mLeftResolution, leftCamera.getCameraMatrix(), distLeftMat, RN[0], mLeftProjection, mLeftRemapLUT);
+		createLUTs(
+			mRightResolution, rightCamera.getCameraMatrix(), distRightMat, RN[1], mRightProjection, mRightRemapLUT);
 
+		mLeftUnmapLUT.reserve(static_cast<size_t>(mLeftResolution.area()));
 		for (const cv::Point2i &pixel : initCoordinateList<cv::Point2i>(mLeftResolution)) {
-			auto p = unmapPoint<cv::Point2f, FunctionImplementation::SubPixel>(CameraPosition::Left, pixel);
-			mLeftUnmapLUT.emplace_back(std::round(p.x), std::round(p.y));
+			mLeftUnmapLUT.push_back(toCompactPoint(
+				unmapPoint<cv::Point2f, FunctionImplementation::SubPixel>(CameraPosition::Left, pixel)));
 		}
+		mRightUnmapLUT.reserve(static_cast<size_t>(mRightResolution.area()));
 		for (const cv::Point2i &pixel : initCoordinateList<cv::Point2i>(mRightResolution)) {
-			auto p = unmapPoint<cv::Point2f, FunctionImplementation::SubPixel>(CameraPosition::Right, pixel);
-			mRightUnmapLUT.emplace_back(std::round(p.x), std::round(p.y));
+			mRightUnmapLUT.push_back(toCompactPoint(
+				unmapPoint<cv::Point2f, FunctionImplementation::SubPixel>(CameraPosition::Right, pixel)));
 		}
 	}
 
@@ -230,7 +333,9 @@ public:
 	}
 
 	/**
-	 * Apply remapping on input events.
+	 * Apply remapping on input events. Each event costs a single look-up of a packed 16-bit coordinate pair in a
+	 * table of 4 bytes per pixel, events remapped outside of the rectified image are discarded. The output is
+	 * written into a single preallocated event packet.
 	 * @param cameraPosition 	Indication whether image is from left or right camera.
 	 * @param events 			Input events.
 	 * @return 					Event with rectified coordinates.
@@ -238,9 +343,9 @@ public:
 	[[nodiscard]] dv::EventStore remapEvents(const CameraPosition cameraPosition, const dv::EventStore &events) const {
 		switch (cameraPosition) {
 			case CameraPosition::Left:
-				return remapEventsInternal(events, mLeftResolution, mLeftValidMask, mLeftRemapLUT);
+				return remapEventsInternal(events, mLeftResolution, mLeftRemapLUT);
 			case CameraPosition::Right:
-				return remapEventsInternal(events, mRightResolution, mRightValidMask, mRightRemapLUT);
+				return remapEventsInternal(events, mRightResolution, mRightRemapLUT);
 			default:
 				throw dv::exceptions::RuntimeError("Invalid camera position value");
 		}
@@ -268,9 +373,8 @@ public:
 					pos = static_cast<size_t>(point.y()) * static_cast<size_t>(mLeftResolution.width)
 						+ static_cast<size_t>(point.x());
 				}
-				dv::runtime_assert(pos < mLeftValidMask.size(), "Event coordinates are out of range");
-				if (mLeftValidMask[pos] == 1) {
-					const cv::Point2i &coords = mLeftRemapLUT[pos];
+				dv::runtime_assert(pos < mLeftRemapLUT.size(), "Event coordinates are out of range");
+				if (const CompactPoint coords = mLeftRemapLUT[pos]; coords.isValid()) {
 					return OutputPoint(coords.x, coords.y);
 				}
 				return std::nullopt;
@@ -285,9 +389,8 @@ public:
 					pos = static_cast<size_t>(point.y()) * static_cast<size_t>(mRightResolution.width)
 						+ static_cast<size_t>(point.x());
 				}
-				dv::runtime_assert(pos < mRightValidMask.size(), "Event coordinates are out of range");
-				if (mRightValidMask[pos] == 1) {
-					const cv::Point2i &coords = mRightRemapLUT[pos];
+				dv::runtime_assert(pos < mRightRemapLUT.size(), "Event coordinates are out of range");
+				if (const CompactPoint coords = mRightRemapLUT[pos]; coords.isValid()) {
 					return OutputPoint(coords.x, coords.y);
 				}
 				return std::nullopt;
@@ -324,11 +427,11 @@ public:
 			}
 			switch (position) {
 				case CameraPosition::Left: {
-					const cv::Point2i &p = mLeftUnmapLUT[address];
+					const CompactPoint p = mLeftUnmapLUT[address];
 					return OutputPoint(p.x, p.y);
 				}
 				case CameraPosition::Right: {
-					const cv::Point2i &p = mRightUnmapLUT[address];
+					const CompactPoint p = mRightUnmapLUT[address];
 					return OutputPoint(p.x, p.y);
 				}
 				default:
@@ -399,34 +502,78 @@ public:
 	 */
 	[[nodiscard]] dv::DepthEventStore estimateDepth(
 		const cv::Mat &disparity, const dv::EventStore &events, const float disparityScale = 16.f) const {
-		DepthEventStore output;
-
-		const float focalLength = static_cast<float>(mLeftProjection.at<double>(0, 0));
+		auto output = std::make_shared<dv::DepthEventPacket>();
+		estimateDepth(disparity, events, output->elements, disparityScale);
+		if (output->elements.empty()) {
+			return {};
+		}
+		return dv::DepthEventStore(std::shared_ptr<const dv::DepthEventPacket>(std::move(output)));
+	}
 
-		const float baselineFocal = std::abs(focalLength * mBaseline);
-		for (const auto &event : events) {
-			const auto pos = static_cast<const size_t>(event.y()) * static_cast<size_t>(mLeftResolution.width)
-						   + static_cast<size_t>(event.x());
-			if (mLeftValidMask[pos]) {
-				const cv::Point2i &pt      = mLeftRemapLUT[pos];
-				const int16_t rawDisparity = disparity.at<int16_t>(pt);
-				if (rawDisparity <= 0) {
-					continue;
+	/**
+	 * Estimate depth given the disparity map and a list of events into a caller-provided buffer. Events are
+	 * processed in parallel chunks, the output preserves the order of the input events. Output buffer is resized to
+	 * the number of events with valid depth, its capacity is reused between calls.
+	 * @see estimateDepth(const cv::Mat &, const dv::EventStore &, const float)
+	 * @param disparity			Disparity map.
+	 * @param events			Input events.
+	 * @param output			Output buffer for depth events, previous content is replaced.
+	 * @param disparityScale	Scale of disparity value in the disparity map, if subpixel accuracy is enabled
+	 * 							in the block matching, this value will be equal to 16.
+	 */
+	void estimateDepth(const cv::Mat &disparity, const dv::EventStore &events, dv::cvector<dv::DepthEvent> &output,
+		const float disparityScale = 16.f) const {
+		validateDisparity(disparity);
+
+		const float scale         = depthScale(disparityScale);
+		const size_t numEvents    = events.size();
+		const size_t numChunks    = (numEvents + DepthEventChunkSize - 1) / DepthEventChunkSize;
+		const CompactPoint *lut   = mLeftRemapLUT.data();
+		const auto width          = static_cast<size_t>(mLeftResolution.width);
+		const auto rectifiedDepth = [&](const dv::Event &event) -> uint16_t {
+			const auto pos = static_cast<size_t>(event.y()) * width + static_cast<size_t>(event.x());
+			dv::runtime_assert(pos < mLeftRemapLUT.size(), "Event coordinates are out of range");
+			if (const CompactPoint pt = lut[pos]; pt.isValid()) {
+				return disparityToDepth(disparity.at<int16_t>(pt.y, pt.x), scale);
+			}
+			return 0;
+		};
+
+		// First pass counts valid events in each chunk, prefix sum gives the output offset of each chunk
+		std::vector<size_t> offsets(numChunks + 1, 0);
+		cv::parallel_for_(cv::Range(0, static_cast<int>(numChunks)), [&](const cv::Range &range) {
+			for (int chunk = range.start; chunk < range.end; chunk++) {
+				const size_t start = static_cast<size_t>(chunk) * DepthEventChunkSize;
+				size_t count       = 0;
+				for (const auto &event : events.slice(start, std::min(DepthEventChunkSize, numEvents - start))) {
+					count += static_cast<size_t>(rectifiedDepth(event) > 0);
 				}
-				const float disp  = (static_cast<float>(rawDisparity) / disparityScale);
-				const float depth = baselineFocal / disp;
-				output.emplace_back(event.timestamp(), event.x(), event.y(), event.polarity(),
-					static_cast<uint16_t>(std::round(depth * 1000.f)));
+				offsets[static_cast<size_t>(chunk) + 1] = count;
 			}
-		}
-
-		return output;
+		});
+		std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+		output.resize(offsets.back());
+
+		// Second pass writes the depth events of each chunk at its offset
+		cv::parallel_for_(cv::Range(0, static_cast<int>(numChunks)), [&](const cv::Range &range) {
+			for (int chunk = range.start; chunk < range.end; chunk++) {
+				const size_t start = static_cast<size_t>(chunk) * DepthEventChunkSize;
+				size_t index       = offsets[static_cast<size_t>(chunk)];
+				for (const auto &event : events.slice(start, std::min(DepthEventChunkSize, numEvents - start))) {
+					if (const uint16_t depth = rectifiedDepth(event); depth > 0) {
+						output[index++]
+							= dv::DepthEvent(event.timestamp(), event.x(), event.y(), event.polarity(), depth);
+					}
+				}
+			}
+		});
 	}
 
 	/**
 	 * Convert a disparity map into a depth frame. Each disparity value is converted into depth using the equation
 	 * depth = (focalLength * baseline) / disparity. Output frame contains distance values expressed
-	 * in integer values of millimeter distance.
+	 * in integer values of millimeter distance, pixels with non-positive (invalid) disparity have zero depth.
 	 *
 	 * NOTE: Output depth frame will not have a timestamp value, it is up to the user of this method to set
 	 * correct timestamp of the disparity map.
@@ -437,25 +584,88 @@ public:
 	 */
 	[[nodiscard]] dv::DepthFrame toDepthFrame(const cv::Mat &disparity, const float disparityScale = 16.f) const {
 		dv::DepthFrame dFrame;
-		dFrame.sizeX = static_cast<int16_t>(disparity.cols);
-		dFrame.sizeY = static_cast<int16_t>(disparity.rows);
-		dFrame.depth.resize(static_cast<size_t>(dFrame.sizeX * dFrame.sizeY));
-
-		cv::Mat depthFrame(dFrame.sizeY, dFrame.sizeX, CV_16SC1, dFrame.depth.data());
-
-		cv::Mat floatDisparity;
-		disparity.convertTo(floatDisparity, CV_32FC1, 1.0 / static_cast<double>(disparityScale));
-
-		const double focalLength   = mLeftProjection.at<double>(0, 0);
-		const double baselineFocal = std::abs(focalLength * static_cast<double>(mBaseline));
-
-		floatDisparity = (baselineFocal / (floatDisparity));
-		floatDisparity.convertTo(depthFrame, CV_16SC1, 1000.);
+		toDepthFrame(disparity, dFrame, disparityScale);
+		return dFrame;
+	}
 
-		dv::runtime_assert(dFrame.depth.size() == static_cast<size_t>(disparity.size().area()),
-			"Output depth frame size doesn't match input disparity map size");
+	/**
+	 * Convert a disparity map into a caller-provided depth frame. Rows are converted in parallel, the depth buffer
+	 * of the frame is only reallocated if its size does not match the disparity map.
+	 *
+	 * NOTE: Timestamp of the output depth frame is not modified.
+	 * @see toDepthFrame(const cv::Mat &, const float)
+	 * @param disparity 		Input disparity map.
+	 * @param output			Output depth frame.
+	 * @param disparityScale	Scale of disparity value in the disparity map, if subpixel accuracy is enabled
+	 * 						in the block matching, this value will be equal to 16.
+	 */
+	void toDepthFrame(const cv::Mat &disparity, dv::DepthFrame &output, const float disparityScale = 16.f) const {
+		validateDisparity(disparity);
+
+		output.sizeX = static_cast<int16_t>(disparity.cols);
+		output.sizeY = static_cast<int16_t>(disparity.rows);
+		output.depth.resize(static_cast<size_t>(disparity.size().area()));
+
+		const float scale = depthScale(disparityScale);
+		uint16_t *depth   = output.depth.data();
+		cv::parallel_for_(cv::Range(0, disparity.rows), [&](const cv::Range &range) {
+			for (int y = range.start; y < range.end; y++) {
+				const auto *row = disparity.ptr<int16_t>(y);
+				uint16_t *out   = depth + static_cast<ptrdiff_t>(y) * disparity.cols;
+				for (int x = 0; x < disparity.cols; x++) {
+					out[x] = disparityToDepth(row[x], scale);
+				}
+			}
+		});
+	}
 
-		return dFrame;
+	/**
+	 * Convert a disparity map into a sparse list of depth samples, containing only pixels with valid (positive)
+	 * disparity. This representation is more compact than a depth frame for semi-dense disparity maps. Rows are
+	 * processed in parallel stripes, the output is ordered in row-major order and its capacity is reused between
+	 * calls.
+	 * @param disparity 		Input disparity map.
+	 * @param output			Output depth samples in rectified pixel space, previous content is replaced.
+	 * @param disparityScale	Scale of disparity value in the disparity map, if subpixel accuracy is enabled
+	 * 						in the block matching, this value will be equal to 16.
+	 */
+	void toSparseDepth(
+		const cv::Mat &disparity, std::vector<SparseDepthPoint> &output, const float disparityScale = 16.f) const {
+		validateDisparity(disparity);
+
+		const float scale     = depthScale(disparityScale);
+		const int numStripes  = (disparity.rows + DepthRowStripeHeight - 1) / DepthRowStripeHeight;
+		const auto stripeRows = [&](const int stripe) {
+			return cv::Range(
+				stripe * DepthRowStripeHeight, std::min((stripe + 1) * DepthRowStripeHeight, disparity.rows));
+		};
+
+		std::vector<size_t> offsets(static_cast<size_t>(numStripes) + 1, 0);
+		cv::parallel_for_(cv::Range(0, numStripes), [&](const cv::Range &range) {
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				const cv::Range rows                     = stripeRows(stripe);
+				offsets[static_cast<size_t>(stripe) + 1] = countValidDisparities(disparity, rows.start, rows.end);
+			}
+		});
+		std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+		output.resize(offsets.back());
+
+		cv::parallel_for_(cv::Range(0, numStripes), [&](const cv::Range &range) {
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				const cv::Range rows = stripeRows(stripe);
+				size_t index         = offsets[static_cast<size_t>(stripe)];
+				for (int y = rows.start; y < rows.end; y++) {
+					const auto *row = disparity.ptr<int16_t>(y);
+					for (int x = 0; x < disparity.cols; x++) {
+						if (row[x] > 0) {
+							output[index++] = SparseDepthPoint{
+								static_cast<int16_t>(x), static_cast<int16_t>(y), disparityToDepth(row[x], scale)};
+						}
+					}
+				}
+			}
+		});
 	}
 };
 
@@ -3,8 +3,11 @@
 #include "../../containers/kd_tree.hpp"
 #include "kernel.hpp"
 
+#include <opencv2/core.hpp>
+
 #include <optional>
 #include <random>
+#include <unordered_map>
 #include <vector>
 
 namespace dv::cluster::mean_shift {
@@ -142,7 +145,7 @@ public:
 	 * @returns The in-cluster variance for each cluster
 	 */
 	template<kernel::MeanShiftKernel kernel = kernel::Epanechnikov>
-	[[nodiscard]] auto fit() {
+	[[nodiscard]] auto fit() const {
 		const auto centres                           = findClusterCentres<kernel>();
 		const auto [labels, sampleCounts, variances] = assignClusters(centres);
 
@@ -202,25 +205,69 @@ public:
 	/**
 	 * Performs the search for the cluster centres for each given starting point. A detected centre is added to the
 	 * set of centres if it isn't closer than the bandwidth to any previously detected centre.
-
+	 *
+	 * The searches from individual starting points are independent and are executed in parallel, detected centres
+	 * are then merged in the order of the starting points, so the output is deterministic. Proximity of previously
+	 * detected centres is checked using a hash grid with cells of bandwidth size, so only centres in neighbouring
+	 * cells are compared.
+	 *
 	 * @tparam kernel the kernel to be used. \see MeanShiftKernel
 	 * @returns The centres of each detected cluster
 	 */
 	template<kernel::MeanShiftKernel kernel>
-	[[nodiscard]] VectorOfVectors findClusterCentres() {
+	[[nodiscard]] VectorOfVectors findClusterCentres() const {
 		VectorOfVectors clusterCentres;
 
-		if (mNumSamples > 0) {
-			for (const auto &startingPoint : mStartingPoints) {
-				const auto mode = performShift<kernel>(startingPoint);
+		if (mNumSamples == 0 || mStartingPoints.empty()) {
+			return clusterCentres;
+		}
+
+		std::vector<std::optional<Vector>> modes(mStartingPoints.size());
+
+		cv::parallel_for_(cv::Range(0, static_cast<int>(mStartingPoints.size())), [&](const cv::Range &range) {
+			for (int i = range.start; i < range.end; i++) {
+				modes[static_cast<size_t>(i)] = performShift<kernel>(mStartingPoints[static_cast<size_t>(i)]);
+			}
+		});
+
+		const float cellSize         = static_cast<float>(std::max<int16_t>(mBandwidth, 1));
+		const float bandwidthSquared = static_cast<float>(mBandwidth) * static_cast<float>(mBandwidth);
+
+		const auto cellCoordinate = [cellSize](const float value) {
+			return static_cast<int32_t>(std::floor(value / cellSize));
+		};
+		const auto cellKey = [](const int32_t cellX, const int32_t cellY) {
+			return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+		};
+
+		std::unordered_map<uint64_t, std::vector<uint32_t>> grid;
+
+		for (const auto &mode : modes) {
+			if (!mode.has_value()) {
+				continue;
+			}
 
-				if (mode.has_value()
-					&& std::none_of(clusterCentres.begin(), clusterCentres.end(), [this, &mode](const auto &centre) {
-						   return squaredDistance(centre, *mode) < mBandwidth * mBandwidth;
-					   })) {
-					clusterCentres.push_back(*mode);
+			const int32_t cellX = cellCoordinate(mode->pt.x());
+			const int32_t cellY = cellCoordinate(mode->pt.y());
+
+			// Any centre closer than the bandwidth lies within the 3x3 cell neighbourhood
+			bool isDuplicate = false;
+			for (int32_t y = cellY - 1; y <= cellY + 1 && !isDuplicate; y++) {
+				for (int32_t x = cellX - 1; x <= cellX + 1 && !isDuplicate; x++) {
+					const auto cell = grid.find(cellKey(x, y));
+					if (cell == grid.end()) {
+						continue;
+					}
+					isDuplicate = std::any_of(cell->second.begin(), cell->second.end(), [&](const uint32_t index) {
+						return squaredDistance(clusterCentres[index], *mode) < bandwidthSquared;
+					});
 				}
 			}
+
+			if (!isDuplicate) {
+				grid[cellKey(cellX, cellY)].push_back(static_cast<uint32_t>(clusterCentres.size()));
+				clusterCentres.push_back(*mode);
+			}
 		}
 
 		return clusterCentres;
@@ -230,6 +277,9 @@ public:
 	 * Assigns the data samples to a cluster by means of a nearest neighbour search, and computes the number of
 	 * samples as well as the in-cluster variance in the process.
 	 *
+	 * The nearest centre search is executed in parallel over the samples, sample counts and variances are
+	 * accumulated afterwards in sample order, so the result does not depend on the thread scheduling.
+	 *
 	 * @param clusterCentres The centres of each detected cluster
 	 * @returns The labels for each data point. The labels correspond to the index of the centre to which the sample
 	 * is assigned.
@@ -237,25 +287,40 @@ public:
 	 * @returns The in-cluster variance for each cluster
 	 */
 	[[nodiscard]] std::tuple<std::vector<uint32_t>, std::vector<uint32_t>, std::vector<float>> assignClusters(
-		const VectorOfVectors &clusterCentres) {
+		const VectorOfVectors &clusterCentres) const {
 		std::vector<uint32_t> labels(mNumSamples);
 		std::vector<uint32_t> sampleCounts(clusterCentres.size());
 		std::vector<float> variances(clusterCentres.size());
 
 		if (!clusterCentres.empty()) {
-			uint32_t sampleIndex = 0;
+			// Event store iterators are not random access, collect the samples for parallel processing
+			std::vector<const dv::Event *> samples;
+			samples.reserve(mNumSamples);
 			for (const auto &sample : mData) {
-				const auto closestClusterCentre = std::min_element(
-					clusterCentres.begin(), clusterCentres.end(), [this, &sample](const auto &c1, const auto &c2) {
-						return squaredDistance(c1, sample) < squaredDistance(c2, sample);
-					});
+				samples.push_back(&sample);
+			}
+
+			std::vector<float> distances(samples.size());
+
+			cv::parallel_for_(cv::Range(0, static_cast<int>(samples.size())), [&](const cv::Range &range) {
+				for (int i = range.start; i < range.end; i++) {
+					const auto &sample = *samples[static_cast<size_t>(i)];
+
+					const auto closestClusterCentre = std::min_element(clusterCentres.begin(), clusterCentres.end(),
+						[this, &sample](const auto &c1, const auto &c2) {
+							return squaredDistance(c1, sample) < squaredDistance(c2, sample);
+						});
+
+					const auto minIndex
+						= static_cast<uint32_t>(std::distance(clusterCentres.begin(), closestClusterCentre));
+					labels[static_cast<size_t>(i)]    = minIndex;
+					distances[static_cast<size_t>(i)] = squaredDistance(clusterCentres[minIndex], sample);
+				}
+			});
 
-				const auto minIndex
-					= static_cast<uint32_t>(std::distance(clusterCentres.begin(), closestClusterCentre));
-				labels[sampleIndex] = minIndex;
-				sampleCounts[minIndex]++;
-				variances[minIndex] += squaredDistance(clusterCentres[minIndex], sample);
-				sampleIndex++;
+			for (size_t sampleIndex = 0; sampleIndex < samples.size(); sampleIndex++) {
+				sampleCounts[labels[sampleIndex]]++;
+				variances[labels[sampleIndex]] += distances[sampleIndex];
 			}
 
 			for (uint32_t i = 0; i < variances.size(); i++) {
@@ -280,7 +345,7 @@ private:
 	 * @returns An std::optional containing either a vector, if the search has converged, std::nullopt otherwise
 	 */
 	template<kernel::MeanShiftKernel kernel>
-	[[nodiscard]] std::optional<Vector> performShift(Vector currentMode) {
+	[[nodiscard]] std::optional<Vector> performShift(Vector currentMode) const {
 		uint32_t iterations = 0;
 
 		float shift  = 0.0f;
@@ -355,7 +420,7 @@ private:
 	 * distance to the centre
 	 */
 	template<kernel::MeanShiftKernel kernel>
-	[[nodiscard]] auto getNeighbours(const Vector &centre) {
+	[[nodiscard]] auto getNeighbours(const Vector &centre) const {
 		return mData.radiusSearch(centre, kernel::getSearchRadius(mBandwidth));
 	}
 
@@ -0,0 +1,388 @@
+#pragma once
+
+#include "../core/core.hpp"
+#include "../data/timed_keypoint_base.hpp"
+#include "../exception/exceptions/generic_exceptions.hpp"
+
+#include <opencv2/core.hpp>
+
+#include <algorithm>
+#include <queue>
+#include <vector>
+
+namespace dv::containers {
+
+/**
+ * Dynamic spatial index for events over a sliding time window. Events are bucketed into a uniform grid of square
+ * cells over the sensor plane, new events are inserted with `accept` and old events are removed with `expire`,
+ * so a sliding window does not require rebuilding the index.
+ *
+ * The search methods provide the same interface and semantics as `dv::containers::kd_tree::KDTreeEventStoreAdaptor`,
+ * including the radius being expressed in squared distance units and the returned distances being squared
+ * distances. Searches are exact, the `eps` parameter is accepted for interface compatibility and ignored.
+ *
+ * Returned event pointers stay valid as long as the events are retained in the index.
+ */
+class EventGridIndex {
+private:
+	/**
+	 * Events of a single cell in time order. Expired events are removed from the front by advancing the head,
+	 * the storage is compacted once more than half of it is expired.
+	 */
+	struct Cell {
+		std::vector<const dv::Event *> events;
+		size_t head = 0;
+
+		void popFront() {
+			head++;
+			if (head == events.size()) {
+				events.clear();
+				head = 0;
+			}
+			else if (head > events.size() / 2) {
+				events.erase(events.begin(), events.begin() + static_cast<ptrdiff_t>(head));
+				head = 0;
+			}
+		}
+	};
+
+	cv::Size mResolution;
+	int16_t mCellSize;
+	cv::Size mGridSize;
+	std::vector<Cell> mCells;
+	dv::EventStore mData;
+
+	[[nodiscard]] size_t cellIndex(const int32_t cellX, const int32_t cellY) const {
+		return static_cast<size_t>(cellY * mGridSize.width + cellX);
+	}
+
+	[[nodiscard]] Cell &cellOf(const dv::Event &event) {
+		return mCells[cellIndex(event.x() / mCellSize, event.y() / mCellSize)];
+	}
+
+	template<class Visitor>
+	void visitCells(const int32_t minX, const int32_t minY, const int32_t maxX, const int32_t maxY,
+		Visitor &&visitor) const {
+		const int32_t cellX0 = std::max(minX, 0) / mCellSize;
+		const int32_t cellY0 = std::max(minY, 0) / mCellSize;
+		const int32_t cellX1 = std::min(maxX / mCellSize, mGridSize.width - 1);
+		const int32_t cellY1 = std::min(maxY / mCellSize, mGridSize.height - 1);
+
+		if (maxX < 0 || maxY < 0) {
+			return;
+		}
+
+		for (int32_t cellY = cellY0; cellY <= cellY1; cellY++) {
+			for (int32_t cellX = cellX0; cellX <= cellX1; cellX++) {
+				const Cell &cell = mCells[cellIndex(cellX, cellY)];
+				for (size_t i = cell.head; i < cell.events.size(); i++) {
+					visitor(cell.events[i]);
+				}
+			}
+		}
+	}
+
+	[[nodiscard]] static int32_t squaredDistance(const dv::Event &event, const int32_t x, const int32_t y) {
+		const int32_t dx = static_cast<int32_t>(event.x()) - x;
+		const int32_t dy = static_cast<int32_t>(event.y()) - y;
+		return dx * dx + dy * dy;
+	}
+
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param resolution Sensor resolution, all indexed events must lie within it.
+	 * @param cellSize Side of a grid cell in pixels. Cells of a size similar to typical search radii provide best
+	 * performance.
+	 */
+	explicit EventGridIndex(const cv::Size &resolution, const int16_t cellSize = 8) :
+		mResolution(resolution),
+		mCellSize(cellSize) {
+		if (cellSize <= 0) {
+			throw dv::exceptions::InvalidArgument<int16_t>("Grid cell size must be positive.", cellSize);
+		}
+		mGridSize
+			= cv::Size((resolution.width + cellSize - 1) / cellSize, (resolution.height + cellSize - 1) / cellSize);
+		mCells.resize(static_cast<size_t>(mGridSize.area()));
+	}
+
+	/**
+	 * Insert events into the index. Events must be newer than any event already in the index. Event data is shared
+	 * with the given event store where possible, same as with `dv::EventStore::add`.
+	 *
+	 * @param events Events to be inserted.
+	 */
+	void accept(const dv::EventStore &events) {
+		// Validates ordering before any modification of the index
+		mData.add(events);
+
+		// Adding may copy the events into the internal storage, so index the stored instances
+		for (const auto &event : mData.sliceBack(events.size())) {
+			cellOf(event).events.push_back(&event);
+		}
+	}
+
+	/**
+	 * Remove all events with timestamp lower than the given one. Events are removed in time order, so the cost is
+	 * proportional to the number of removed events.
+	 *
+	 * @param timestamp Timestamp of the oldest event to be retained.
+	 */
+	void expire(const int64_t timestamp) {
+		if (mData.isEmpty() || mData.getLowestTime() >= timestamp) {
+			return;
+		}
+
+		for (const auto &event : mData) {
+			if (event.timestamp() >= timestamp) {
+				break;
+			}
+			// Cells keep events in global time order, so the oldest event of the store is at the head of its cell
+			cellOf(event).popFront();
+		}
+
+		mData = mData.sliceTime(timestamp);
+	}
+
+	/**
+	 * Remove all events from the index.
+	 */
+	void clear() {
+		for (auto &cell : mCells) {
+			cell.events.clear();
+			cell.head = 0;
+		}
+		mData = dv::EventStore();
+	}
+
+	/**
+	 * Searches for the k nearest neighbours surrounding centrePoint.
+	 *
+	 * @param centrePoint The point for which the nearest neighbours are to be searched
+	 * @param numClosest The number of neighbours to be searched (i.e. the parameter "k")
+	 * @return The found neighbours and their squared distances, sorted by increasing distance
+	 */
+	template<typename T>
+	[[nodiscard]] auto knnSearch(const cv::Point_<T> &centrePoint, const size_t numClosest) const {
+		return knnSearch(centrePoint.x, centrePoint.y, numClosest);
+	}
+
+	/**
+	 * Searches for the k nearest neighbours surrounding centrePoint.
+	 *
+	 * @param centrePoint The point for which the nearest neighbours are to be searched
+	 * @param numClosest The number of neighbours to be searched (i.e. the parameter "k")
+	 * @return The found neighbours and their squared distances, sorted by increasing distance
+	 */
+	[[nodiscard]] auto knnSearch(const dv::Event &centrePoint, const size_t numClosest) const {
+		return knnSearch(centrePoint.x(), centrePoint.y(), numClosest);
+	}
+
+	/**
+	 * Searches for the k nearest neighbours surrounding centrePoint.
+	 *
+	 * @param centrePoint The point for which the nearest neighbours are to be searched
+	 * @param numClosest The number of neighbours to be searched (i.e. the parameter "k")
+	 * @return The found neighbours and their squared distances, sorted by increasing distance
+	 */
+	[[nodiscard]] auto knnSearch(const dv::TimedKeyPoint &centrePoint, const size_t numClosest) const {
+		return knnSearch(static_cast<int32_t>(std::round(centrePoint.pt.x())),
+			static_cast<int32_t>(std::round(centrePoint.pt.y())), numClosest);
+	}
+
+	/**
+	 * Searches for the k nearest neighbours surrounding centrePoint. Cells are visited in rings of growing
+	 * distance around the centre, the search stops as soon as no unvisited cell can contain a closer event.
+	 *
+	 * @param x The x-coordinate of the centre point for which the nearest neighbours are to be searched
+	 * @param y The y-coordinate of the centre point for which the nearest neighbours are to be searched
+	 * @param numClosest The number of neighbours to be searched (i.e. the parameter "k")
+	 * @return The found neighbours and their squared distances, sorted by increasing distance
+	 */
+	[[nodiscard]] std::vector<std::pair<const dv::Event *, int32_t>> knnSearch(
+		const int32_t x, const int32_t y, const size_t numClosest) const {
+		std::vector<std::pair<const dv::Event *, int32_t>> eventsAndDistances;
+
+		if (numClosest == 0 || mData.isEmpty()) {
+			return eventsAndDistances;
+		}
+
+		const auto farther = [](const auto &a, const auto &b) {
+			return a.second < b.second;
+		};
+		// Max-heap on distance holding the current best candidates
+		std::priority_queue<std::pair<const dv::Event *, int32_t>,
+			std::vector<std::pair<const dv::Event *, int32_t>>, decltype(farther)>
+			best(farther);
+
+		const auto consider = [&](const dv::Event *event) {
+			const int32_t distance = squaredDistance(*event, x, y);
+			if (best.size() < numClosest) {
+				best.emplace(event, distance);
+			}
+			else if (distance < best.top().second) {
+				best.pop();
+				best.emplace(event, distance);
+			}
+		};
+
+		const int32_t centreX   = std::clamp(x, 0, mResolution.width - 1) / mCellSize;
+		const int32_t centreY   = std::clamp(y, 0, mResolution.height - 1) / mCellSize;
+		const int32_t maxRing   = std::max(mGridSize.width, mGridSize.height);
+		const int32_t cellSize  = mCellSize;
+		const int32_t lastCellX = mGridSize.width - 1;
+		const int32_t lastCellY = mGridSize.height - 1;
+
+		for (int32_t ring = 0; ring <= maxRing; ring++) {
+			if (best.size() == numClosest && ring > 0) {
+				// Closest possible distance to any cell of this ring
+				const int32_t reachX = std::min(x - (centreX - ring + 1) * cellSize, (centreX + ring) * cellSize - x);
+				const int32_t reachY = std::min(y - (centreY - ring + 1) * cellSize, (centreY + ring) * cellSize - y);
+				const int32_t reach  = std::max(std::min(reachX, reachY), 0);
+				if (reach * reach > best.top().second) {
+					break;
+				}
+			}
+
+			for (int32_t cellY = centreY - ring; cellY <= centreY + ring; cellY++) {
+				if (cellY < 0 || cellY > lastCellY) {
+					continue;
+				}
+				const bool edgeRow = (cellY == centreY - ring || cellY == centreY + ring);
+				const int32_t step = edgeRow ? 1 : 2 * ring;
+				for (int32_t cellX = centreX - ring; cellX <= centreX + ring; cellX += std::max(step, 1)) {
+					if (cellX < 0 || cellX > lastCellX) {
+						continue;
+					}
+					const Cell &cell = mCells[cellIndex(cellX, cellY)];
+					for (size_t i = cell.head; i < cell.events.size(); i++) {
+						consider(cell.events[i]);
+					}
+				}
+			}
+		}
+
+		eventsAndDistances.resize(best.size());
+		for (auto iter = eventsAndDistances.rbegin(); iter != eventsAndDistances.rend(); iter++) {
+			*iter = best.top();
+			best.pop();
+		}
+
+		return eventsAndDistances;
+	}
+
+	/**
+	 * Searches for all neighbours surrounding centrePoint that are within a certain radius.
+	 *
+	 * @param centrePoint The point for which the nearest neighbours are to be searched
+	 * @param radius The radius, in squared distance units
+	 * @param eps Ignored, the search is exact
+	 * @param sorted True if the neighbours should be sorted with respect to their distance to centrePoint
+	 * @return The found neighbours and their squared distances
+	 */
+	template<typename T>
+	[[nodiscard]] auto radiusSearch(
+		const cv::Point_<T> &centrePoint, const int16_t &radius, float eps = 0.0f, bool sorted = false) const {
+		return radiusSearch(centrePoint.x, centrePoint.y, radius, eps, sorted);
+	}
+
+	/**
+	 * Searches for all neighbours surrounding centrePoint that are within a certain radius.
+	 *
+	 * @param centrePoint The point for which the nearest neighbours are to be searched
+	 * @param radius The radius, in squared distance units
+	 * @param eps Ignored, the search is exact
+	 * @param sorted True if the neighbours should be sorted with respect to their distance to centrePoint
+	 * @return The found neighbours and their squared distances
+	 */
+	[[nodiscard]] auto radiusSearch(
+		const dv::Event &centrePoint, const int16_t &radius, float eps = 0.0f, bool sorted = false) const {
+		return radiusSearch(centrePoint.x(), centrePoint.y(), radius, eps, sorted);
+	}
+
+	/**
+	 * Searches for all neighbours surrounding centrePoint that are within a certain radius.
+	 *
+	 * @param centrePoint The point for which the nearest neighbours are to be searched
+	 * @param radius The radius, in squared distance units
+	 * @param eps Ignored, the search is exact
+	 * @param sorted True if the neighbours should be sorted with respect to their distance to centrePoint
+	 * @return The found neighbours and their squared distances
+	 */
+	[[nodiscard]] auto radiusSearch(
+		const dv::TimedKeyPoint &centrePoint, const int16_t &radius, float eps = 0.0f, bool sorted = false) const {
+		return radiusSearch(static_cast<int32_t>(std::round(centrePoint.pt.x())),
+			static_cast<int32_t>(std::round(centrePoint.pt.y())), radius, eps, sorted);
+	}
+
+	/**
+	 * Searches for all neighbours surrounding centrePoint that are within a certain radius. Same as the KD-tree
+	 * adaptor, an event is returned if its squared distance to the centre is lower than the radius value.
+	 *
+	 * @param x The x-coordinate of the centre point for which the nearest neighbours are to be searched
+	 * @param y The y-coordinate of the centre point for which the nearest neighbours are to be searched
+	 * @param radius The radius, in squared distance units
+	 * @param eps Ignored, the search is exact
+	 * @param sorted True if the neighbours should be sorted with respect to their distance to centrePoint
+	 * @return The found neighbours and their squared distances
+	 */
+	[[nodiscard]] std::vector<std::pair<const dv::Event *, int32_t>> radiusSearch(const int32_t x, int32_t y,
+		const int16_t &radius, [[maybe_unused]] float eps = 0.0f, bool sorted = false) const {
+		std::vector<std::pair<const dv::Event *, int32_t>> eventsAndDistances;
+
+		if (radius <= 0 || mData.isEmpty()) {
+			return eventsAndDistances;
+		}
+
+		const auto reach = static_cast<int32_t>(std::ceil(std::sqrt(static_cast<float>(radius))));
+		visitCells(x - reach, y - reach, x + reach, y + reach, [&](const dv::Event *event) {
+			const int32_t distance = squaredDistance(*event, x, y);
+			if (distance < radius) {
+				eventsAndDistances.emplace_back(event, distance);
+			}
+		});
+
+		if (sorted) {
+			std::sort(eventsAndDistances.begin(), eventsAndDistances.end(), [](const auto &a, const auto &b) {
+				return a.second < b.second;
+			});
+		}
+
+		return eventsAndDistances;
+	}
+
+	/**
+	 * Returns an iterator to the begin of the indexed events
+	 * @return an iterator to the begin of the indexed events
+	 */
+	[[nodiscard]] dv::EventStore::iterator begin() const noexcept {
+		return mData.begin();
+	}
+
+	/**
+	 * Returns an iterator to the end of the indexed events
+	 * @return  an iterator to the end of the indexed events
+	 */
+	[[nodiscard]] dv::EventStore::iterator end() const noexcept {
+		return mData.end();
+	}
+
+	/**
+	 * Get the number of indexed events.
+	 * @return Number of events in the index.
+	 */
+	[[nodiscard]] size_t size() const noexcept {
+		return mData.size();
+	}
+
+	/**
+	 * Get the indexed events.
+	 * @return Event store containing all indexed events in time order.
+	 */
+	[[nodiscard]] const dv::EventStore &getEvents() const noexcept {
+		return mData;
+	}
+};
+
+} // namespace dv::containers
@@ -2017,6 +2017,231 @@ static_assert(dv::concepts::EventToFrameConverter<TimeSurface, EventStore>);
 static_assert(dv::concepts::BlockAccessible<TimeSurface>);
 static_assert(dv::concepts::TimeSurface<TimeSurface, EventStore>);
 
+/**
+ * Multi-resolution time surface, which maintains a full resolution time surface together with a number of
+ * coarser levels in a single update pass. Level `l` has the resolution of the full time surface downsampled by
+ * `2^l` (rounded up), each pixel of it holds the maximum timestamp of the corresponding `2^l x 2^l` block of the
+ * full resolution surface (max-pooling). The levels are regular time surfaces, so they can be accessed with the
+ * usual `at()`, `operator()` and `block()` methods.
+ *
+ * Level 0 behaves exactly like `TimeSurfaceBase`. Sparse inputs are propagated to the coarser levels per event,
+ * for dense event stores it is cheaper to update level 0 only and max-pool the coarser levels once afterwards. The
+ * choice is made per event store, both give the same result as long as events are accepted in time order.
+ * @tparam EventStoreType 	Type of underlying event store
+ * @tparam ScalarType 		Type of the stored timestamps
+ */
+template<class EventStoreType, typename ScalarType = int64_t>
+class TimeSurfacePyramidBase {
+public:
+	using Scalar    = ScalarType;
+	using LevelType = TimeSurfaceBase<EventStoreType, ScalarType>;
+
+	/**
+	 * Dummy constructor
+	 * Constructs a new, empty TimeSurfacePyramid without any levels allocated.
+	 */
+	TimeSurfacePyramidBase() = default;
+
+	/**
+	 * Creates a new TimeSurfacePyramid with the given full resolution and number of levels. All levels are
+	 * zero initialized.
+	 * @param size 		Full resolution of the time surface, the size of level 0.
+	 * @param numLevels Number of pyramid levels including the full resolution level, at least one.
+	 */
+	explicit TimeSurfacePyramidBase(const cv::Size &size, const size_t numLevels) {
+		if (numLevels == 0 || numLevels > 16) {
+			throw dv::exceptions::InvalidArgument<size_t>(
+				"Time surface pyramid expects between 1 and 16 levels.", numLevels);
+		}
+
+		mLevels.reserve(numLevels);
+		for (size_t level = 0; level < numLevels; level++) {
+			const int scale = 1 << level;
+			mLevels.emplace_back(cv::Size((size.width + scale - 1) / scale, (size.height + scale - 1) / scale));
+		}
+	}
+
+	/**
+	 * Inserts the event store into all levels of the time surface pyramid.
+	 * @param store The event store to be added
+	 * @return A reference to this TimeSurfacePyramidBase.
+	 */
+	TimeSurfacePyramidBase &operator<<(const EventStoreType &store) {
+		accept(store);
+		return *this;
+	}
+
+	/**
+	 * Inserts the event into all levels of the time surface pyramid.
+	 * @param event The event to be added
+	 * @return A reference to this TimeSurfacePyramidBase.
+	 */
+	TimeSurfacePyramidBase &operator<<(const typename EventStoreType::iterator::value_type &event) {
+		accept(event);
+		return *this;
+	}
+
+	/**
+	 * Generates a frame from the full resolution level.
+	 * @param mat The storage where the frame should be generated
+	 * @return A reference to the generated frame.
+	 */
+	dv::Frame &operator>>(dv::Frame &mat) const {
+		mat = generateFrame();
+		return mat;
+	}
+
+	/**
+	 * Inserts the event store into all levels of the time surface pyramid.
+	 * @param store The event store to be added
+	 */
+	void accept(const EventStoreType &store) {
+		// A per event update writes one pixel per coarser level, while max-pooling reads about 4/3 of the full
+		// resolution pixels in total at roughly half the cost per pixel
+		const auto fullResolutionPixels = static_cast<size_t>(size().area());
+		if (mLevels.size() < 2 || store.size() * (mLevels.size() - 1) * 2 < fullResolutionPixels) {
+			for (const auto &event : store) {
+				accept(event);
+			}
+			return;
+		}
+
+		auto &fullResolution = mLevels.front();
+		for (const auto &event : store) {
+			fullResolution.at(event.y(), event.x()) = static_cast<ScalarType>(event.timestamp());
+		}
+		for (size_t level = 1; level < mLevels.size(); level++) {
+			maxPool(mLevels[level - 1], mLevels[level]);
+		}
+	}
+
+	/**
+	 * Inserts the event into all levels of the time surface pyramid.
+	 * @param event The event to be added
+	 */
+	void accept(const typename EventStoreType::iterator::value_type &event) {
+		const auto timestamp = static_cast<ScalarType>(event.timestamp());
+
+		// Bounds are checked on the full resolution level, coarser levels cover the same area
+		mLevels.front().at(event.y(), event.x()) = timestamp;
+
+		for (size_t level = 1; level < mLevels.size(); level++) {
+			auto &value = mLevels[level](static_cast<int16_t>(event.y() >> level),
+				static_cast<int16_t>(event.x() >> level));
+			value = std::max(value, timestamp);
+		}
+	}
+
+	/**
+	 * Returns a level of the pyramid.
+	 * @param level Index of the level, 0 is the full resolution.
+	 * @return A const reference to the time surface of the requested level.
+	 */
+	[[nodiscard]] const LevelType &level(const size_t level) const {
+		if (level >= mLevels.size()) {
+			throw std::range_error("Attempted to access out-of-range level in TimeSurfacePyramidBase.");
+		}
+
+		return mLevels[level];
+	}
+
+	/**
+	 * Returns a const reference to the element at the given coordinates of a pyramid level.
+	 * @param level Index of the level, 0 is the full resolution.
+	 * @param y The y coordinate of the element to be accessed, in the coordinates of the level.
+	 * @param x The x coordinate of the element to be accessed, in the coordinates of the level.
+	 * @return A const reference to the element at the requested coordinates.
+	 */
+	[[nodiscard]] const ScalarType &at(const size_t level, const int16_t y, const int16_t x) const {
+		return this->level(level).at(y, x);
+	}
+
+	/**
+	 * Returns a block of a pyramid level.
+	 * @param level Index of the level, 0 is the full resolution.
+	 * @param topRow the row coordinate at the top of the block
+	 * @param leftCol the column coordinate at the left of the block
+	 * @param height the height of the block
+	 * @param width the width of the block
+	 * @return the block
+	 */
+	[[nodiscard]] auto block(const size_t level, const int16_t topRow, const int16_t leftCol, const int16_t height,
+		const int16_t width) const {
+		return this->level(level).block(topRow, leftCol, height, width);
+	}
+
+	/**
+	 * Generates a frame from a pyramid level.
+	 * @param level Index of the level, 0 is the full resolution.
+	 * @return The generated frame.
+	 */
+	[[nodiscard]] dv::Frame generateFrame(const size_t level = 0) const {
+		return this->level(level).generateFrame();
+	}
+
+	/**
+	 * Sets all values in all levels to zero.
+	 */
+	void reset() {
+		for (auto &level : mLevels) {
+			level.reset();
+		}
+	}
+
+	/**
+	 * Returns the number of levels of the pyramid.
+	 * @return Number of levels, including the full resolution level.
+	 */
+	[[nodiscard]] size_t levels() const noexcept {
+		return mLevels.size();
+	}
+
+	/**
+	 * The full resolution size of the pyramid.
+	 * @return Returns the size of level 0 as an opencv size
+	 */
+	[[nodiscard]] cv::Size size() const noexcept {
+		return mLevels.empty() ? cv::Size() : mLevels.front().size();
+	}
+
+	/**
+	 * Returns true if the pyramid has no levels allocated.
+	 * @return true if the pyramid does not contain any levels
+	 */
+	[[nodiscard]] bool isEmpty() const noexcept {
+		return mLevels.empty();
+	}
+
+private:
+	std::vector<LevelType> mLevels;
+
+	/**
+	 * Downsample a level by a factor of two, each target pixel is the maximum of the corresponding 2x2 block.
+	 * @param source 	Finer level
+	 * @param target 	Coarser level, half the size of the source rounded up
+	 */
+	static void maxPool(const LevelType &source, LevelType &target) {
+		const auto lastRow = static_cast<int16_t>(source.rows() - 1);
+		const auto lastCol = static_cast<int16_t>(source.cols() - 1);
+
+		// Column-major order matches the storage order of the time surface
+		for (int16_t col = 0; col < target.cols(); col++) {
+			const auto col0 = static_cast<int16_t>(col * 2);
+			const auto col1 = std::min(static_cast<int16_t>(col0 + 1), lastCol);
+			for (int16_t row = 0; row < target.rows(); row++) {
+				const auto row0 = static_cast<int16_t>(row * 2);
+				const auto row1 = std::min(static_cast<int16_t>(row0 + 1), lastRow);
+				target(row, col)
+					= std::max({source(row0, col0), source(row1, col0), source(row0, col1), source(row1, col1)});
+			}
+		}
+	}
+};
+
+using TimeSurfacePyramid = TimeSurfacePyramidBase<EventStore>;
+
+static_assert(dv::concepts::EventToFrameConverter<TimeSurfacePyramid, EventStore>);
+
 /**
  * A speed invariant time surface, as described by https://arxiv.org/abs/1903.11332
  * @tparam EventStoreType 	Type of underlying event store
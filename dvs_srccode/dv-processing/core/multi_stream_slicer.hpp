@@ -196,7 +196,10 @@ public:
 	 */
 	int doEveryTimeInterval(
 		const dv::Duration interval, std::function<void(const dv::TimeWindow &, const MapOfVariants &)> callback) {
-		auto internalCallback = [&, callback](const dv::TimeWindow &time, const MainStreamType &packet) {
+		auto execution       = std::make_shared<JobExecution>();
+		execution->mCallback = callback;
+
+		auto internalCallback = [&, execution](const dv::TimeWindow &time, const MainStreamType &packet) {
 			MapOfVariants data;
 			data.insert(std::make_pair(mMainStreamName, packet));
 
@@ -208,7 +211,7 @@ public:
 				data[stream] = slicePacket(time.startTime, time.endTime, streamBuffer);
 			}
 
-			callback(time, data);
+			dispatch(*execution, time, std::move(data));
 
 			mSeekTime = time.endTime;
 		};
@@ -219,7 +222,7 @@ public:
 
 		const int index = mMainSlicer.doEveryTimeInterval(interval, internalCallback);
 
-		mConfig.emplace(std::make_pair(index, SliceJob(duration, callback)));
+		mConfig.emplace(std::make_pair(index, SliceJob(duration, callback, execution)));
 		return index;
 	}
 
@@ -266,8 +269,11 @@ public:
 
 		std::function<void(const MainStreamType &)> internalCallback;
 
+		auto execution       = std::make_shared<JobExecution>();
+		execution->mCallback = callback;
+
 		if (timeSlicingApproach == TimeSlicingApproach::BACKWARD) {
-			internalCallback = [&, callback, lastTime = -1LL](const MainStreamType &packet) mutable {
+			internalCallback = [&, execution, lastTime = -1LL](const MainStreamType &packet) mutable {
 				dv::runtime_assert(!isPacketEmpty(packet),
 					"Number based slicing received an empty packet, this should never "
 					"happen! Please report a bug.");
@@ -287,12 +293,12 @@ public:
 
 				lastTime = timeWindow.endTime;
 
-				callback(timeWindow, data);
+				dispatch(*execution, timeWindow, std::move(data));
 			};
 		}
 		else {
 			// Forward slicing, delayed by one slice
-			internalCallback = [&, callback, lastSlice = MainStreamType()](const MainStreamType &packet) mutable {
+			internalCallback = [&, execution, lastSlice = MainStreamType()](const MainStreamType &packet) mutable {
 				dv::runtime_assert(!isPacketEmpty(packet),
 					"Number based slicing received an empty packet, this should never "
 					"happen! Please report a bug.");
@@ -318,13 +324,14 @@ public:
 
 				lastSlice = packet;
 
-				callback(dv::TimeWindow(timeWindowLast.startTime, timeWindowCurrent.startTime), data);
+				dispatch(*execution, dv::TimeWindow(timeWindowLast.startTime, timeWindowCurrent.startTime),
+					std::move(data));
 			};
 		}
 
 		int index = mMainSlicer.doEveryNumberOfElements(n, internalCallback);
 
-		mConfig.emplace(std::make_pair(index, SliceJob(n, timeSlicingApproach, callback)));
+		mConfig.emplace(std::make_pair(index, SliceJob(n, timeSlicingApproach, callback, execution)));
 
 		return index;
 	}
@@ -427,10 +434,84 @@ public:
 		if (!hasJob(jobId)) {
 			return;
 		}
+		runSynchronously(jobId);
 		mConfig.erase(jobId);
 		mMainSlicer.removeJob(jobId);
 	}
 
+	/**
+	 * Set the thread pool used for asynchronous job execution. Only affects jobs that are switched to asynchronous
+	 * execution after this call. If no executor is set, the global thread pool is used.
+	 * @param executor Thread pool for asynchronous job execution.
+	 */
+	void setExecutor(std::shared_ptr<dv::ThreadPool> executor) {
+		mExecutor = std::move(executor);
+	}
+
+	/**
+	 * Execute the callback of the given job asynchronously on the thread pool. Data slicing and book-keeping is
+	 * still performed within the `accept()` call, only the callback is executed on a worker thread. The slices of
+	 * the job are delivered to the callback in order, one at a time. At most `maxInFlight` slices of the job can be
+	 * queued or in processing, if the job falls behind, `accept()` blocks until the job catches up. Exceptions thrown
+	 * by the callback are rethrown by a subsequent `accept()` or `waitForAsyncJobs()` call.
+	 * @param jobId The job to be executed asynchronously.
+	 * @param maxInFlight Maximum number of queued and in-processing slices for this job.
+	 */
+	void runAsynchronously(const int jobId, const size_t maxInFlight = 2) {
+		if (!hasJob(jobId)) {
+			return;
+		}
+
+		if (mExecutor == nullptr) {
+			mExecutor = dv::ThreadPool::global();
+		}
+
+		auto &execution = *mConfig.at(jobId).mExecution;
+		if (execution.mQueue != nullptr) {
+			execution.mQueue->wait();
+		}
+		execution.mQueue = std::make_shared<dv::OrderedTaskQueue>(mExecutor, maxInFlight);
+	}
+
+	/**
+	 * Execute the callback of the given job synchronously within the `accept()` call, this is the default.
+	 * Waits for all pending slices of the job if it was executed asynchronously.
+	 * @param jobId The job to be executed synchronously.
+	 */
+	void runSynchronously(const int jobId) {
+		if (!hasJob(jobId)) {
+			return;
+		}
+
+		auto &execution = *mConfig.at(jobId).mExecution;
+		if (execution.mQueue != nullptr) {
+			execution.mQueue->wait();
+			execution.mQueue.reset();
+		}
+	}
+
+	/**
+	 * Check whether the given job is executed asynchronously.
+	 * @param jobId The job id.
+	 * @return True if the job exists and is executed asynchronously, false otherwise.
+	 */
+	[[nodiscard]] bool isAsynchronous(const int jobId) const {
+		const auto job = mConfig.find(jobId);
+		return job != mConfig.end() && job->second.mExecution->mQueue != nullptr;
+	}
+
+	/**
+	 * Block until all asynchronous jobs have processed all of their pending slices.
+	 * @throws Rethrows the first exception thrown by an asynchronous job callback.
+	 */
+	void waitForAsyncJobs() {
+		for (auto &[_, job] : mConfig) {
+			if (job.mExecution->mQueue != nullptr) {
+				job.mExecution->mQueue->wait();
+			}
+		}
+	}
+
 	/**
 	 * Update a stream's seek time manually and evaluate jobs.
 	 *
@@ -451,6 +532,18 @@ public:
 	}
 
 protected:
+	/**
+	 * Execution state of a job, shared between the job configuration and the internal slicing callback.
+	 */
+	struct JobExecution {
+		/// Job callback, all slices of the job are delivered to this instance.
+		std::function<void(const dv::TimeWindow &, const MapOfVariants &)> mCallback;
+
+		/// Queue for asynchronous execution of the callback, nullptr if the job is executed synchronously. Declared
+		/// after the callback, so pending tasks complete before the callback is destroyed.
+		std::shared_ptr<dv::OrderedTaskQueue> mQueue = nullptr;
+	};
+
 	/**
 	 * Internal container of slice jobs.
 	 */
@@ -468,11 +561,13 @@ protected:
 		 * Create a slice job
 		 * @param intervalUS Job execution interval in microseconds
 		 * @param callback The callback method
+		 * @param execution Execution state of the job
 		 */
-		SliceJob(const int64_t intervalUS, JobCallback callback) :
+		SliceJob(const int64_t intervalUS, JobCallback callback, std::shared_ptr<JobExecution> execution) :
 			mType(SliceType::TIME),
 			mCallback(std::move(callback)),
-			mInterval(intervalUS) {
+			mInterval(intervalUS),
+			mExecution(std::move(execution)) {
 		}
 
 		/**
@@ -480,12 +575,15 @@ protected:
 		 * @param number Number of elements to be sliced
 		 * @param slicing Slicing method for gaps between numeric slices
 		 * @param callback The callback method
+		 * @param execution Execution state of the job
 		 */
-		SliceJob(const size_t number, const TimeSlicingApproach slicing, JobCallback callback) :
+		SliceJob(const size_t number, const TimeSlicingApproach slicing, JobCallback callback,
+			std::shared_ptr<JobExecution> execution) :
 			mType(SliceType::NUMBER),
 			mCallback(std::move(callback)),
 			mNumberOfElements(number),
-			mTimeSlicing(slicing) {
+			mTimeSlicing(slicing),
+			mExecution(std::move(execution)) {
 		}
 
 		SliceType mType;
@@ -501,6 +599,9 @@ protected:
 
 		/// Time slicing method for slicing by number
 		TimeSlicingApproach mTimeSlicing = TimeSlicingApproach::BACKWARD;
+
+		/// Execution state, synchronous or asynchronous
+		std::shared_ptr<JobExecution> mExecution;
 	};
 
 	/// Maximum retain duration, this holds maximum interval from all configured jobs
@@ -530,7 +631,28 @@ protected:
 	/// Slicer for the main stream, all other streams follow the main stream slicer
 	dv::StreamSlicer<MainStreamType> mMainSlicer;
 
+	/// Thread pool for asynchronous job execution
+	std::shared_ptr<dv::ThreadPool> mExecutor = nullptr;
+
 private:
+	/**
+	 * Execute a job callback on sliced data, either in place or by queueing it for asynchronous execution.
+	 * @param execution Execution state of the job, holds the job callback.
+	 * @param window Time window of the slice.
+	 * @param data Sliced data, ownership is passed to the callback.
+	 */
+	static void dispatch(const JobExecution &execution, const dv::TimeWindow &window, MapOfVariants &&data) {
+		if (execution.mQueue == nullptr) {
+			execution.mCallback(window, data);
+			return;
+		}
+
+		// Tasks call the stored callback, so stateful callbacks keep their state as in synchronous execution
+		execution.mQueue->submit([callback = &execution.mCallback, window, data = std::move(data)] {
+			(*callback)(window, data);
+		});
+	}
+
 	/**
 	 * Slice a vector type within given time bounds [start, end). Start time is inclusive, end time is exclusive.
 	 * @tparam VectorType
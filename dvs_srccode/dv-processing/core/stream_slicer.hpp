@@ -2,6 +2,7 @@
 
 #include "../exception/exceptions/generic_exceptions.hpp"
 #include "concepts.hpp"
+#include "thread_pool.hpp"
 #include "time_window.hpp"
 #include "utils.hpp"
 
@@ -25,6 +26,11 @@ concept CompatibleWithSlicer = requires {
 /**
  * The StreamSlicer is a class that takes on incoming timestamped data, stores
  * them in a minimal way and invokes functions at individual periods.
+ *
+ * By default, all job callbacks are executed synchronously within the `accept()` call. Individual jobs can
+ * be switched to asynchronous execution with `runAsynchronously()`, such jobs are executed on a thread pool,
+ * each job still receives its slices strictly in order, one slice at a time, while different asynchronous jobs
+ * run concurrently and do not block each other.
  */
 template<class PacketType>
 requires concepts::CompatibleWithSlicer<PacketType>
@@ -32,6 +38,14 @@ class StreamSlicer {
 public:
 	StreamSlicer() = default;
 
+	/**
+	 * Create a slicer that executes asynchronous jobs on the given thread pool.
+	 * @param executor Thread pool for asynchronous job execution.
+	 * @sa runAsynchronously
+	 */
+	explicit StreamSlicer(std::shared_ptr<dv::ThreadPool> executor) : mExecutor(std::move(executor)) {
+	}
+
 	/**
 	 * Add a full packet to the streaming buffer and evaluate jobs.
 	 * This function copies the data over.
@@ -239,6 +253,7 @@ public:
 		if (!hasJob(jobId)) {
 			return;
 		}
+		runSynchronously(jobId);
 		mSliceJobs.erase(jobId);
 	}
 
@@ -277,6 +292,81 @@ public:
 		mSliceJobs[jobId].setNumberInterval(numberInterval);
 	}
 
+	/**
+	 * Set the thread pool used for asynchronous job execution. Only affects jobs that are switched to asynchronous
+	 * execution after this call. If no executor is set, the global thread pool is used.
+	 * @param executor Thread pool for asynchronous job execution.
+	 */
+	void setExecutor(std::shared_ptr<dv::ThreadPool> executor) {
+		mExecutor = std::move(executor);
+	}
+
+	/**
+	 * Execute the callback of the given job asynchronously on the thread pool. The slices of the job are delivered
+	 * to the callback in order, one at a time. At most `maxInFlight` slices of the job can be queued or in
+	 * processing, if the job falls behind, `accept()` blocks until the job catches up. Exceptions thrown by the
+	 * callback are rethrown by the next `accept()` or `waitForAsyncJobs()` call.
+	 *
+	 * The slice passed to an asynchronous callback is owned by that callback invocation, but the callback
+	 * itself is executed on a worker thread, so any state it shares with other threads must be synchronized.
+	 * @param jobId The job to be executed asynchronously.
+	 * @param maxInFlight Maximum number of queued and in-processing slices for this job.
+	 */
+	void runAsynchronously(const int jobId, const size_t maxInFlight = 2) {
+		if (!hasJob(jobId)) {
+			return;
+		}
+
+		if (mExecutor == nullptr) {
+			mExecutor = dv::ThreadPool::global();
+		}
+
+		auto &job = mSliceJobs[jobId];
+		if (job.mExecutionQueue != nullptr) {
+			job.mExecutionQueue->wait();
+		}
+		job.mExecutionQueue = std::make_shared<dv::OrderedTaskQueue>(mExecutor, maxInFlight);
+	}
+
+	/**
+	 * Execute the callback of the given job synchronously within the `accept()` call, this is the default.
+	 * Waits for all pending slices of the job if it was executed asynchronously.
+	 * @param jobId The job to be executed synchronously.
+	 */
+	void runSynchronously(const int jobId) {
+		if (!hasJob(jobId)) {
+			return;
+		}
+
+		auto &job = mSliceJobs[jobId];
+		if (job.mExecutionQueue != nullptr) {
+			job.mExecutionQueue->wait();
+			job.mExecutionQueue.reset();
+		}
+	}
+
+	/**
+	 * Check whether the given job is executed asynchronously.
+	 * @param jobId The job id.
+	 * @return True if the job exists and is executed asynchronously, false otherwise.
+	 */
+	[[nodiscard]] bool isAsynchronous(const int jobId) const {
+		const auto job = mSliceJobs.find(jobId);
+		return job != mSliceJobs.end() && job->second.mExecutionQueue != nullptr;
+	}
+
+	/**
+	 * Block until all asynchronous jobs have processed all of their pending slices.
+	 * @throws Rethrows the first exception thrown by an asynchronous job callback.
+	 */
+	void waitForAsyncJobs() {
+		for (auto &[_, job] : mSliceJobs) {
+			if (job.mExecutionQueue != nullptr) {
+				job.mExecutionQueue->wait();
+			}
+		}
+	}
+
 private:
 	/**
 	 * __INTERNAL USE ONLY__
@@ -334,7 +424,7 @@ private:
 						slice = sliceByNumber(packet, mLastCallEnd, mNumberInterval);
 					}
 					mLastCallEnd = mLastCallEnd + mNumberInterval;
-					mCallback(dv::packets::getPacketTimeWindow(slice), slice);
+					dispatch(dv::packets::getPacketTimeWindow(slice), std::move(slice));
 				}
 			}
 
@@ -355,7 +445,7 @@ private:
 					}
 					const dv::TimeWindow window(mLastCallEndTime, mLastCallEndTime + mTimeInterval);
 					mLastCallEndTime = mLastCallEndTime + mTimeInterval;
-					mCallback(window, slice);
+					dispatch(window, std::move(slice));
 				}
 			}
 		}
@@ -387,6 +477,24 @@ private:
 		size_t mLastCallEnd = 0;
 
 	private:
+		/**
+		 * __INTERNAL USE ONLY__
+		 * Execute the callback on the slice, either in place or by queueing it for asynchronous execution.
+		 * @param window Time window of the slice.
+		 * @param slice The data slice, ownership is passed to the callback.
+		 */
+		void dispatch(const dv::TimeWindow &window, PacketType &&slice) {
+			if (mExecutionQueue == nullptr) {
+				mCallback(window, slice);
+				return;
+			}
+
+			// Tasks call the stored callback, so stateful callbacks keep their state as in synchronous execution
+			mExecutionQueue->submit([callback = &mCallback, window, slice = std::move(slice)]() mutable {
+				(*callback)(window, slice);
+			});
+		}
+
 		template<class ElementVector>
 		[[nodiscard]] static inline ElementVector sliceByNumber(
 			const ElementVector &packet, const size_t fromIndex, const size_t number) {
@@ -433,6 +541,11 @@ private:
 		int64_t mTimeInterval    = 0;
 		size_t mNumberInterval   = 0;
 		int64_t mLastCallEndTime = 0;
+
+	public:
+		/// Queue for asynchronous execution of the callback, nullptr if the job is executed synchronously. Declared
+		/// after the callback, so pending tasks complete before the callback is destroyed.
+		std::shared_ptr<dv::OrderedTaskQueue> mExecutionQueue = nullptr;
 	};
 
 	/// Global storage packet that holds just as many data elements as minimally required for all outstanding calls
@@ -442,6 +555,9 @@ private:
 	std::map<int, SliceJob> mSliceJobs;
 	int mHashCounter = 0;
 
+	/// Thread pool for asynchronous job execution
+	std::shared_ptr<dv::ThreadPool> mExecutor = nullptr;
+
 	/**
 	 * Should get called as soon as there is fresh data available.
 	 * It loops through all jobs and determines if they can run on the new data.
@@ -0,0 +1,295 @@
+#pragma once
+
+#include "../exception/exceptions/generic_exceptions.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace dv {
+
+/**
+ * A fixed size pool of worker threads executing submitted tasks in FIFO order. The pool is intended for coarse
+ * grained asynchronous work, like running slicer callbacks or independent tracker instances, fine grained data
+ * parallel loops should rather use `cv::parallel_for_`.
+ */
+class ThreadPool {
+public:
+	/**
+	 * Create a thread pool and start the worker threads.
+	 * @param numThreads Number of worker threads, defaults to the number of hardware threads available.
+	 */
+	explicit ThreadPool(const size_t numThreads = std::max(std::thread::hardware_concurrency(), 1U)) {
+		if (numThreads == 0) {
+			throw dv::exceptions::InvalidArgument<size_t>(
+				"Thread pool requires at least one worker thread.", numThreads);
+		}
+
+		mWorkers.reserve(numThreads);
+		for (size_t i = 0; i < numThreads; i++) {
+			mWorkers.emplace_back([this] {
+				workerThread();
+			});
+		}
+	}
+
+	ThreadPool(const ThreadPool &other)            = delete;
+	ThreadPool &operator=(const ThreadPool &other) = delete;
+	ThreadPool(ThreadPool &&other)                 = delete;
+	ThreadPool &operator=(ThreadPool &&other)      = delete;
+
+	/**
+	 * Destructor executes all remaining queued tasks and joins the worker threads.
+	 */
+	~ThreadPool() {
+		{
+			const std::scoped_lock lock(mMutex);
+			mStopRequested = true;
+		}
+		mTaskAvailable.notify_all();
+
+		for (auto &worker : mWorkers) {
+			worker.join();
+		}
+	}
+
+	/**
+	 * Submit a task for execution on one of the worker threads.
+	 * @param task Callable without arguments.
+	 * @return A future holding the result of the task, exceptions thrown by the task are rethrown when
+	 * retrieving the result from the future.
+	 */
+	template<class Task>
+	requires std::is_invocable_v<Task>
+	std::future<std::invoke_result_t<Task>> submit(Task &&task) {
+		using ResultType = std::invoke_result_t<Task>;
+
+		auto packaged = std::make_shared<std::packaged_task<ResultType()>>(std::forward<Task>(task));
+		auto future   = packaged->get_future();
+
+		{
+			const std::scoped_lock lock(mMutex);
+			if (mStopRequested) {
+				throw dv::exceptions::RuntimeError("Submitting a task into a stopped thread pool.");
+			}
+
+			mTasks.emplace_back([packaged] {
+				(*packaged)();
+			});
+		}
+		mTaskAvailable.notify_one();
+
+		return future;
+	}
+
+	/**
+	 * Get the number of worker threads.
+	 * @return Number of worker threads in this pool.
+	 */
+	[[nodiscard]] size_t size() const {
+		return mWorkers.size();
+	}
+
+	/**
+	 * Get a process wide shared thread pool instance with one worker per hardware thread. The instance is
+	 * created on first call.
+	 * @return Shared pointer to the global thread pool.
+	 */
+	[[nodiscard]] static std::shared_ptr<ThreadPool> global() {
+		static const auto pool = std::make_shared<ThreadPool>();
+		return pool;
+	}
+
+private:
+	std::mutex mMutex;
+	std::condition_variable mTaskAvailable;
+	std::deque<std::function<void()>> mTasks;
+	bool mStopRequested = false;
+	std::vector<std::thread> mWorkers;
+
+	void workerThread() {
+		while (true) {
+			std::function<void()> task;
+
+			{
+				std::unique_lock lock(mMutex);
+				mTaskAvailable.wait(lock, [this] {
+					return mStopRequested || !mTasks.empty();
+				});
+
+				if (mTasks.empty()) {
+					// Stop requested and no work left.
+					return;
+				}
+
+				task = std::move(mTasks.front());
+				mTasks.pop_front();
+			}
+
+			task();
+		}
+	}
+};
+
+/**
+ * A queue that executes tasks on a thread pool strictly one after another, in the order of submission. Tasks of
+ * different queues sharing the same pool run concurrently. The number of submitted but not yet completed tasks
+ * is bounded, submitting into a full queue blocks the caller until a task completes, which applies backpressure
+ * on the producer instead of buffering unbounded amounts of data.
+ *
+ * Exceptions thrown by a task are stored and rethrown on the next call to `submit()` or `wait()`.
+ */
+class OrderedTaskQueue {
+public:
+	/**
+	 * Create an ordered task queue.
+	 * @param pool Thread pool used to execute the tasks.
+	 * @param maxInFlight Maximum number of submitted tasks that are not yet completed.
+	 */
+	OrderedTaskQueue(std::shared_ptr<ThreadPool> pool, const size_t maxInFlight) :
+		mState(std::make_shared<State>()),
+		mPool(std::move(pool)) {
+		if (mPool == nullptr) {
+			throw dv::exceptions::NullPointer("Ordered task queue requires a valid thread pool.");
+		}
+		if (maxInFlight == 0) {
+			throw dv::exceptions::InvalidArgument<size_t>(
+				"Maximum number of in-flight tasks must be at least one.", maxInFlight);
+		}
+
+		mState->mMaxInFlight = maxInFlight;
+	}
+
+	OrderedTaskQueue(const OrderedTaskQueue &other)            = delete;
+	OrderedTaskQueue &operator=(const OrderedTaskQueue &other) = delete;
+
+	/**
+	 * Destructor waits for all submitted tasks to complete, exceptions from pending tasks are discarded.
+	 */
+	~OrderedTaskQueue() {
+		std::unique_lock lock(mState->mMutex);
+		mState->mTaskCompleted.wait(lock, [this] {
+			return mState->mInFlight == 0;
+		});
+	}
+
+	/**
+	 * Submit a task, blocks if the number of in-flight tasks has reached the limit.
+	 * @param task Task to be executed.
+	 * @throws Rethrows any exception that was thrown by a previously executed task.
+	 */
+	void submit(std::function<void()> task) {
+		bool scheduleDrain = false;
+
+		{
+			std::unique_lock lock(mState->mMutex);
+			mState->mTaskCompleted.wait(lock, [this] {
+				return mState->mInFlight < mState->mMaxInFlight || mState->mException;
+			});
+			rethrowStoredException();
+
+			mState->mTasks.push_back(std::move(task));
+			mState->mInFlight++;
+
+			if (!mState->mRunning) {
+				mState->mRunning = true;
+				scheduleDrain    = true;
+			}
+		}
+
+		if (scheduleDrain) {
+			// The drain task keeps the state alive, it is safe to outlive this queue object.
+			mPool->submit([state = mState] {
+				drain(*state);
+			});
+		}
+	}
+
+	/**
+	 * Block until all submitted tasks are completed.
+	 * @throws Rethrows any exception that was thrown by an executed task.
+	 */
+	void wait() {
+		std::unique_lock lock(mState->mMutex);
+		mState->mTaskCompleted.wait(lock, [this] {
+			return mState->mInFlight == 0;
+		});
+		rethrowStoredException();
+	}
+
+	/**
+	 * Get the number of submitted tasks that have not completed yet.
+	 * @return Number of in-flight tasks.
+	 */
+	[[nodiscard]] size_t getInFlightCount() const {
+		const std::scoped_lock lock(mState->mMutex);
+		return mState->mInFlight;
+	}
+
+	/**
+	 * Get the maximum number of in-flight tasks.
+	 * @return Maximum number of in-flight tasks.
+	 */
+	[[nodiscard]] size_t getMaxInFlight() const {
+		const std::scoped_lock lock(mState->mMutex);
+		return mState->mMaxInFlight;
+	}
+
+private:
+	struct State {
+		mutable std::mutex mMutex;
+		std::condition_variable mTaskCompleted;
+		std::deque<std::function<void()>> mTasks;
+		size_t mMaxInFlight = 1;
+		size_t mInFlight    = 0;
+		bool mRunning       = false;
+		std::exception_ptr mException;
+	};
+
+	std::shared_ptr<State> mState;
+	std::shared_ptr<ThreadPool> mPool;
+
+	void rethrowStoredException() {
+		if (mState->mException) {
+			std::rethrow_exception(std::exchange(mState->mException, nullptr));
+		}
+	}
+
+	static void drain(State &state) {
+		std::unique_lock lock(state.mMutex);
+
+		while (!state.mTasks.empty()) {
+			auto task = std::move(state.mTasks.front());
+			state.mTasks.pop_front();
+
+			lock.unlock();
+			std::exception_ptr exception;
+			try {
+				task();
+			}
+			catch (...) {
+				exception = std::current_exception();
+			}
+			lock.lock();
+
+			// Only the first exception is kept, it is rethrown on the producer side.
+			if (exception && !state.mException) {
+				state.mException = exception;
+			}
+			state.mInFlight--;
+			state.mTaskCompleted.notify_all();
+		}
+
+		state.mRunning = false;
+		state.mTaskCompleted.notify_all();
+	}
+};
+
+} // namespace dv
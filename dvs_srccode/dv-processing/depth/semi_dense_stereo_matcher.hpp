@@ -5,6 +5,10 @@
 #include "../core/frame.hpp"
 #include "utils.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 namespace dv {
 
 /**
@@ -24,6 +28,84 @@ protected:
 	std::unique_ptr<dv::camera::StereoGeometry> mStereoGeometry = nullptr;
 
 private:
+	int mBandHeight = 0;
+	int mBandMargin = 0;
+	size_t mBandCount       = 0;
+	size_t mRecomputedBands = 0;
+	cv::Mat mDisparity;
+	cv::Mat mPreviousLeft;
+	cv::Mat mPreviousRight;
+	std::vector<int> mChangedRowsPrefix;
+	std::vector<int> mDirtyBands;
+	std::vector<std::shared_ptr<cv::StereoMatcher>> mBandMatchers;
+
+	/**
+	 * Create an independent instance of a stereo matcher with identical parameters. OpenCV matchers keep internal
+	 * buffers, so a single instance cannot compute disparity of multiple bands concurrently.
+	 * @param matcher 	Stereo matcher to be copied.
+	 * @return 			A new instance of the matcher or nullptr if the matcher type is not supported.
+	 */
+	[[nodiscard]] static std::shared_ptr<cv::StereoMatcher> cloneMatcher(
+		const std::shared_ptr<cv::StereoMatcher> &matcher) {
+		if (const auto sgbm = std::dynamic_pointer_cast<cv::StereoSGBM>(matcher); sgbm != nullptr) {
+			return cv::StereoSGBM::create(sgbm->getMinDisparity(), sgbm->getNumDisparities(), sgbm->getBlockSize(),
+				sgbm->getP1(), sgbm->getP2(), sgbm->getDisp12MaxDiff(), sgbm->getPreFilterCap(),
+				sgbm->getUniquenessRatio(), sgbm->getSpeckleWindowSize(), sgbm->getSpeckleRange(), sgbm->getMode());
+		}
+		if (const auto bm = std::dynamic_pointer_cast<cv::StereoBM>(matcher); bm != nullptr) {
+			auto copy = cv::StereoBM::create(bm->getNumDisparities(), bm->getBlockSize());
+			copy->setMinDisparity(bm->getMinDisparity());
+			copy->setSpeckleWindowSize(bm->getSpeckleWindowSize());
+			copy->setSpeckleRange(bm->getSpeckleRange());
+			copy->setDisp12MaxDiff(bm->getDisp12MaxDiff());
+			copy->setPreFilterType(bm->getPreFilterType());
+			copy->setPreFilterSize(bm->getPreFilterSize());
+			copy->setPreFilterCap(bm->getPreFilterCap());
+			copy->setTextureThreshold(bm->getTextureThreshold());
+			copy->setUniquenessRatio(bm->getUniquenessRatio());
+			copy->setSmallerBlockSize(bm->getSmallerBlockSize());
+			return copy;
+		}
+		return nullptr;
+	}
+
+	/**
+	 * Compute disparity of the given row bands, bands are distributed over independent matcher instances and
+	 * computed in parallel. Each band is computed with additional margin rows of context above and below.
+	 */
+	void computeBands(const cv::Mat &left, const cv::Mat &right) {
+		if (mBandMatchers.empty()) {
+			const auto count = static_cast<size_t>(std::max(cv::getNumThreads(), 1));
+			for (size_t i = 0; i < count; i++) {
+				auto copy = cloneMatcher(mMatcher);
+				if (copy == nullptr) {
+					// Unknown matcher type, fall back to serial computation with the configured instance
+					mBandMatchers = {mMatcher};
+					break;
+				}
+				mBandMatchers.push_back(std::move(copy));
+			}
+		}
+
+		const size_t chunks = std::min(mBandMatchers.size(), mDirtyBands.size());
+		cv::parallel_for_(cv::Range(0, static_cast<int>(chunks)), [&](const cv::Range &range) {
+			cv::Mat bandDisparity;
+			for (int chunk = range.start; chunk < range.end; chunk++) {
+				auto &matcher     = *mBandMatchers[static_cast<size_t>(chunk)];
+				const size_t from = (static_cast<size_t>(chunk) * mDirtyBands.size()) / chunks;
+				const size_t to   = ((static_cast<size_t>(chunk) + 1) * mDirtyBands.size()) / chunks;
+				for (size_t i = from; i < to; i++) {
+					const int y0     = mDirtyBands[i] * mBandHeight;
+					const int y1     = std::min(left.rows, y0 + mBandHeight);
+					const int top    = std::max(0, y0 - mBandMargin);
+					const int bottom = std::min(left.rows, y1 + mBandMargin);
+					matcher.compute(left.rowRange(top, bottom), right.rowRange(top, bottom), bandDisparity);
+					bandDisparity.rowRange(y0 - top, y1 - top).copyTo(mDisparity.rowRange(y0, y1));
+				}
+			}
+		});
+	}
+
 	/**
 	 * Validates stereo geometry pointer, throws an error if the value is unset.
 	 */
@@ -125,9 +207,135 @@ public:
 		mRightAccumulator->accept(right);
 		mRightFrame = mRightAccumulator->generateFrame();
 
+		if (mBandHeight > 0) {
+			return computeIncremental(mLeftFrame.image, mRightFrame.image);
+		}
 		return compute(mLeftFrame.image, mRightFrame.image);
 	}
 
+	/**
+	 * Enable incremental disparity computation. The rectified image pair is split into horizontal bands of rows
+	 * and on each call only the bands that changed since the previous call are recomputed, disparity of other bands
+	 * is reused from the previous result. A band is recomputed if any row within the band or within the margin
+	 * around it changed in either image. Changed bands are computed in parallel, each on its own copy of the stereo
+	 * matcher (supported for cv::StereoSGBM and cv::StereoBM, other matchers compute bands serially).
+	 *
+	 * Disparity within a band depends only on the band and its margin rows, so results can slightly differ from
+	 * full frame computation close to band borders, larger margin reduces the difference. When enabled,
+	 * `computeDisparity` uses `computeIncremental`.
+	 *
+	 * The band matchers are copies of the configured stereo matcher taken on the first incremental computation.
+	 * After changing parameters of the stereo matcher, call `resetIncrementalState`, otherwise the bands are still
+	 * computed with the previous parameters.
+	 * @param bandHeight 	Height of a band in rows, zero disables incremental computation.
+	 * @param margin 		Number of additional context rows above and below each band.
+	 */
+	void setIncrementalComputation(const int bandHeight, const int margin = 16) {
+		if (bandHeight < 0) {
+			throw dv::exceptions::InvalidArgument<int>("Band height must be non-negative.", bandHeight);
+		}
+		if (margin < 0) {
+			throw dv::exceptions::InvalidArgument<int>("Band margin must be non-negative.", margin);
+		}
+
+		mBandHeight = bandHeight;
+		mBandMargin = margin;
+		resetIncrementalState();
+	}
+
+	/**
+	 * Discard the previous disparity and images, the next incremental computation computes the full frame. The band
+	 * matchers are discarded as well and copied again from the configured stereo matcher, call this method after
+	 * changing the parameters of the stereo matcher.
+	 */
+	void resetIncrementalState() {
+		mDisparity.release();
+		mPreviousLeft.release();
+		mPreviousRight.release();
+		mBandMatchers.clear();
+		mBandCount       = 0;
+		mRecomputedBands = 0;
+	}
+
+	/**
+	 * Compute stereo disparity incrementally given a time synchronized pair of images, only bands that changed
+	 * since the previous call are recomputed. The first call, or a call after change of image size or type,
+	 * computes the full frame. If incremental computation is disabled, this is equivalent to `compute`.
+	 * @param leftImage		Left image of a stereo pair of images.
+	 * @param rightImage 	Right image of a stereo pair of images.
+	 * @return 				Disparity map computed by the configured block matcher.
+	 * @sa setIncrementalComputation
+	 */
+	[[nodiscard]] cv::Mat computeIncremental(const cv::Mat &leftImage, const cv::Mat &rightImage) {
+		if (mBandHeight <= 0) {
+			return compute(leftImage, rightImage);
+		}
+
+		cv::Mat left  = leftImage;
+		cv::Mat right = rightImage;
+		if (mStereoGeometry != nullptr) {
+			left  = mStereoGeometry->remapImage(camera::StereoGeometry::CameraPosition::Left, leftImage);
+			right = mStereoGeometry->remapImage(camera::StereoGeometry::CameraPosition::Right, rightImage);
+		}
+
+		const int rows = left.rows;
+		mBandCount     = static_cast<size_t>((rows + mBandHeight - 1) / mBandHeight);
+
+		if (mDisparity.empty() || left.size() != mPreviousLeft.size() || left.type() != mPreviousLeft.type()
+			|| right.size() != mPreviousRight.size() || right.type() != mPreviousRight.type()) {
+			mMatcher->compute(left, right, mDisparity);
+			mRecomputedBands = mBandCount;
+		}
+		else {
+			// Prefix sum of rows that changed in any of the images, allows constant time checks of row ranges
+			const size_t leftRowBytes  = static_cast<size_t>(left.cols) * left.elemSize();
+			const size_t rightRowBytes = static_cast<size_t>(right.cols) * right.elemSize();
+			mChangedRowsPrefix.resize(static_cast<size_t>(rows) + 1);
+			mChangedRowsPrefix[0] = 0;
+			for (int y = 0; y < rows; y++) {
+				const bool changed = std::memcmp(left.ptr(y), mPreviousLeft.ptr(y), leftRowBytes) != 0
+								  || std::memcmp(right.ptr(y), mPreviousRight.ptr(y), rightRowBytes) != 0;
+				mChangedRowsPrefix[static_cast<size_t>(y) + 1]
+					= mChangedRowsPrefix[static_cast<size_t>(y)] + (changed ? 1 : 0);
+			}
+
+			mDirtyBands.clear();
+			for (int band = 0; band < static_cast<int>(mBandCount); band++) {
+				const int top    = std::max(0, band * mBandHeight - mBandMargin);
+				const int bottom = std::min(rows, (band + 1) * mBandHeight + mBandMargin);
+				if (mChangedRowsPrefix[static_cast<size_t>(bottom)] != mChangedRowsPrefix[static_cast<size_t>(top)]) {
+					mDirtyBands.push_back(band);
+				}
+			}
+
+			mRecomputedBands = mDirtyBands.size();
+			if (!mDirtyBands.empty()) {
+				computeBands(left, right);
+			}
+		}
+
+		left.copyTo(mPreviousLeft);
+		right.copyTo(mPreviousRight);
+
+		return mDisparity.clone();
+	}
+
+	/**
+	 * Get the number of row bands of the last incremental computation.
+	 * @return 	Number of bands.
+	 */
+	[[nodiscard]] size_t getBandCount() const {
+		return mBandCount;
+	}
+
+	/**
+	 * Get the number of row bands recomputed during the last incremental computation.
+	 * @return 	Number of recomputed bands.
+	 */
+	[[nodiscard]] size_t getRecomputedBandCount() const {
+		return mRecomputedBands;
+	}
+
 	/**
 	 * Compute stereo disparity given a time synchronized pair of images. Images will be rectified before computing
 	 * disparity if a StereoGeometry class instance was provided.
@@ -209,6 +417,49 @@ public:
 		validateStereoGeometry();
 		return mStereoGeometry->toDepthFrame(disparity, disparityScale);
 	}
+
+	/**
+	 * Estimate depth given the disparity map and a list of events into a caller-provided buffer.
+	 * @see dv::camera::StereoGeometry::estimateDepth
+	 * @param disparity			Disparity map.
+	 * @param events			Input events.
+	 * @param output			Output buffer for depth events, previous content is replaced.
+	 * @param disparityScale	Scale of disparity value in the disparity map, if subpixel accuracy is enabled
+	 * 						in the block matching, this value will be equal to 16.
+	 */
+	inline void estimateDepth(const cv::Mat &disparity, const dv::EventStore &events,
+		dv::cvector<dv::DepthEvent> &output, const float disparityScale = 16.f) const {
+		validateStereoGeometry();
+		mStereoGeometry->estimateDepth(disparity, events, output, disparityScale);
+	}
+
+	/**
+	 * Convert a disparity map into a caller-provided depth frame.
+	 * @see dv::camera::StereoGeometry::toDepthFrame
+	 * @param disparity 		Input disparity map.
+	 * @param output			Output depth frame.
+	 * @param disparityScale	Scale of disparity value in the disparity map, if subpixel accuracy is enabled
+	 * 						in the block matching, this value will be equal to 16.
+	 */
+	inline void estimateDepthFrame(
+		const cv::Mat &disparity, dv::DepthFrame &output, const float disparityScale = 16.f) const {
+		validateStereoGeometry();
+		mStereoGeometry->toDepthFrame(disparity, output, disparityScale);
+	}
+
+	/**
+	 * Convert a disparity map into a sparse list of depth samples of pixels with valid disparity.
+	 * @see dv::camera::StereoGeometry::toSparseDepth
+	 * @param disparity 		Input disparity map.
+	 * @param output			Output depth samples in rectified pixel space, previous content is replaced.
+	 * @param disparityScale	Scale of disparity value in the disparity map, if subpixel accuracy is enabled
+	 * 						in the block matching, this value will be equal to 16.
+	 */
+	inline void estimateSparseDepth(const cv::Mat &disparity,
+		std::vector<dv::camera::StereoGeometry::SparseDepthPoint> &output, const float disparityScale = 16.f) const {
+		validateStereoGeometry();
+		mStereoGeometry->toSparseDepth(disparity, output, disparityScale);
+	}
 };
 
 } // namespace dv
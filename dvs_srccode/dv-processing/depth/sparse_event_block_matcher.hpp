@@ -6,6 +6,11 @@
 
 #include <opencv2/imgproc.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 namespace dv {
 
 class SparseEventBlockMatcher {
@@ -27,6 +32,21 @@ protected:
 
 	std::unique_ptr<dv::camera::StereoGeometry> mStereoGeometry = nullptr;
 
+	/**
+	 * Reusable buffers for matching a single point, one instance is used per parallel task.
+	 */
+	struct MatchBuffers {
+		std::vector<float> templateBuffer;
+		std::vector<float> correlations;
+		std::vector<double> columnSums;
+		std::vector<double> columnSquaredSums;
+	};
+
+	/**
+	 * Number of interest points matched by a single parallel task.
+	 */
+	static constexpr int PointBatchSize = 64;
+
 	template<dv::concepts::Coordinate2D InputPoint>
 	[[nodiscard]] cv::Rect getPointRoi(const InputPoint &center, const int32_t offsetX, const int32_t stretchX) const {
 		if constexpr (dv::concepts::Coordinate2DAccessors<InputPoint>) {
@@ -247,69 +267,31 @@ public:
 		}
 
 		std::vector<PixelDisparity> output;
-		output.reserve(interestPoints.size());
-		const cv::Rect leftRegion(0, 0, mLeftFrame.image.cols, mLeftFrame.image.rows);
-		const cv::Rect rightRegion(0, 0, mRightFrame.image.cols, mRightFrame.image.rows);
+		output.reserve(points.size());
 		for (const auto &[pixel, point] : points) {
-			cv::Point2i outputPoint;
 			if constexpr (dv::concepts::Coordinate2DAccessors<PointType>) {
-				outputPoint = cv::Point2i(point.x(), point.y());
+				output.emplace_back(cv::Point2i(point.x(), point.y()), false);
 			}
 			else {
-				outputPoint = cv::Point2i(point.x, point.y);
-			}
-			if (!pixel.has_value()) {
-				output.emplace_back(outputPoint, false);
-				continue;
-			}
-
-			// Here we select the region of interest on left image
-			const cv::Rect templateROI = getPointRoi(*pixel, 0, 0);
-			// Limit the region is not outside of the valid image space.
-			const cv::Mat template_ = mLeftFrame.image(templateROI & leftRegion);
-
-			// Here we select the search space for template matching on the right image. Template is selected
-			// by going for left-most max-disparity pixel location and to the right by the number of disparities
-			// from configuration. This select a horizontal template matching space.
-			const cv::Rect imageROI = getPointRoi(*pixel, -mMaxDisparity, numDisparities);
-			// Limit the region is not outside of the valid image space.
-			const cv::Mat image = mRightFrame.image(imageROI & rightRegion);
-
-			// Reject patches that are too small
-			if (image.cols - template_.cols <= 1) {
-				output.emplace_back(outputPoint, false);
-				continue;
+				output.emplace_back(cv::Point2i(point.x, point.y), false);
 			}
-
-			// Run template matching
-			cv::Mat result;
-			cv::matchTemplate(image, template_, result, cv::TemplateMatchModes::TM_CCOEFF_NORMED);
-			Eigen::VectorXf correlations;
-			cv::cv2eigen(result.reshape(0, result.cols), correlations);
-
-			// Softmax score
-			auto shifted                = correlations.array() * 20.f;
-			auto exponents              = shifted.exp();
-			const auto probabilities    = (exponents / exponents.sum());
-			const float meanProbability = probabilities.mean();
-			const float stddev          = std::sqrt(
-                (probabilities - meanProbability).square().sum() / (static_cast<float>(probabilities.size())));
-
-			// Disparity value at maximum probability
-			int32_t disparity;
-			const float probability = probabilities.maxCoeff(&disparity);
-
-			const float correlation = correlations(disparity);
-			// If standard deviation close to zero, override score to zero since this assigns high zscores on
-			// noise
-			const float score = stddev < 0.1f ? 0.f : (probability - meanProbability) / stddev;
-
-			// Actual disparity value corrected to the search space configuration
-			const int32_t disparityValue = (image.cols - template_.cols) - disparity + mMinDisparity;
-			output.emplace_back(outputPoint, score >= mMinScore, correlation, score, disparityValue, *pixel,
-				cv::Point2i(pixel->x - disparityValue, pixel->y));
 		}
 
+		// Points are matched in batches on multiple threads, matching buffers are reused within a batch
+		const auto numPoints = static_cast<int>(points.size());
+		cv::parallel_for_(
+			cv::Range(0, numPoints),
+			[&](const cv::Range &range) {
+				MatchBuffers buffers;
+				for (int i = range.start; i < range.end; i++) {
+					const auto &pixel = points[static_cast<size_t>(i)].first;
+					if (pixel.has_value()) {
+						matchPoint(*pixel, buffers, output[static_cast<size_t>(i)]);
+					}
+				}
+			},
+			std::ceil(static_cast<double>(numPoints) / static_cast<double>(PointBatchSize)));
+
 		return output;
 	}
 
@@ -419,6 +401,156 @@ public:
 	void setMinScore(const float minimumScore) {
 		mMinScore = minimumScore;
 	}
+
+private:
+	/**
+	 * Match a template around the given point on the left image along the epipolar line in the right image. The
+	 * normalized correlation coefficient is computed equally to `cv::matchTemplate` with `TM_CCOEFF_NORMED`: the
+	 * cross correlation with the zero-mean template is computed directly, while window sums and squared sums are
+	 * slid along column sums of the search region, so only the pixels of the search region are visited.
+	 * @param pixel				Interest point in the left (rectified) image space.
+	 * @param buffers			Reusable matching buffers.
+	 * @param result			Output disparity result, kept unchanged if the point cannot be matched.
+	 */
+	void matchPoint(const cv::Point2i &pixel, MatchBuffers &buffers, PixelDisparity &result) const {
+		const int32_t numDisparities = mMaxDisparity - mMinDisparity;
+
+		// Here we select the region of interest on left image, limited to the valid image space.
+		const cv::Rect templateRect
+			= getPointRoi(pixel, 0, 0) & cv::Rect(0, 0, mLeftFrame.image.cols, mLeftFrame.image.rows);
+
+		// Here we select the search space for template matching on the right image. Template is selected
+		// by going for left-most max-disparity pixel location and to the right by the number of disparities
+		// from configuration. This select a horizontal template matching space.
+		const cv::Rect imageRect = getPointRoi(pixel, -mMaxDisparity, numDisparities)
+								 & cv::Rect(0, 0, mRightFrame.image.cols, mRightFrame.image.rows);
+
+		// Reject patches that are too small
+		if (imageRect.width - templateRect.width <= 1 || imageRect.height < templateRect.height
+			|| templateRect.area() == 0) {
+			return;
+		}
+
+		const int width     = templateRect.width;
+		const int height    = templateRect.height;
+		const int positions = imageRect.width - width + 1;
+		const auto area     = static_cast<double>(templateRect.area());
+
+		auto &templateBuffer = buffers.templateBuffer;
+		auto &correlations   = buffers.correlations;
+
+		// Zero-mean template
+		templateBuffer.resize(static_cast<size_t>(templateRect.area()));
+		double templateSum = 0.0;
+		for (int y = 0; y < height; y++) {
+			const auto *row = mLeftFrame.image.ptr<uint8_t>(templateRect.y + y) + templateRect.x;
+			for (int x = 0; x < width; x++) {
+				templateSum += row[x];
+			}
+		}
+		const double templateMean = templateSum / area;
+		double templateSquaredSum = 0.0;
+		for (int y = 0; y < height; y++) {
+			const auto *row  = mLeftFrame.image.ptr<uint8_t>(templateRect.y + y) + templateRect.x;
+			float *zeroMean  = templateBuffer.data() + static_cast<ptrdiff_t>(y * width);
+			for (int x = 0; x < width; x++) {
+				const double value  = static_cast<double>(row[x]) - templateMean;
+				zeroMean[x]         = static_cast<float>(value);
+				templateSquaredSum += value * value;
+			}
+		}
+		const double templateNorm = std::sqrt(templateSquaredSum);
+
+		correlations.assign(static_cast<size_t>(positions), 0.f);
+		if (templateNorm < std::numeric_limits<double>::epsilon()) {
+			// Constant template, same convention as OpenCV
+			std::fill(correlations.begin(), correlations.end(), 1.f);
+		}
+		else {
+			auto &columnSums        = buffers.columnSums;
+			auto &columnSquaredSums = buffers.columnSquaredSums;
+			columnSums.assign(static_cast<size_t>(imageRect.width), 0.0);
+			columnSquaredSums.assign(static_cast<size_t>(imageRect.width), 0.0);
+
+			for (int y = 0; y < height; y++) {
+				const auto *imageRow    = mRightFrame.image.ptr<uint8_t>(imageRect.y + y) + imageRect.x;
+				const float *templateRow = templateBuffer.data() + static_cast<ptrdiff_t>(y * width);
+				for (int d = 0; d < positions; d++) {
+					float sum = 0.f;
+					for (int x = 0; x < width; x++) {
+						sum += templateRow[x] * static_cast<float>(imageRow[d + x]);
+					}
+					correlations[static_cast<size_t>(d)] += sum;
+				}
+				for (int x = 0; x < imageRect.width; x++) {
+					const auto value                           = static_cast<double>(imageRow[x]);
+					columnSums[static_cast<size_t>(x)]        += value;
+					columnSquaredSums[static_cast<size_t>(x)] += value * value;
+				}
+			}
+
+			// Window sums are slid along the columns, the sums are integers so no rounding error accumulates
+			double windowSum        = 0.0;
+			double windowSquaredSum = 0.0;
+			for (int x = 0; x < width; x++) {
+				windowSum        += columnSums[static_cast<size_t>(x)];
+				windowSquaredSum += columnSquaredSums[static_cast<size_t>(x)];
+			}
+			for (int d = 0; d < positions; d++) {
+				if (d > 0) {
+					const auto entering = static_cast<size_t>(d + width - 1);
+					const auto leaving  = static_cast<size_t>(d - 1);
+					windowSum          += columnSums[entering] - columnSums[leaving];
+					windowSquaredSum   += columnSquaredSums[entering] - columnSquaredSums[leaving];
+				}
+				const double norm
+					= std::sqrt(std::max(windowSquaredSum - (windowSum * windowSum) / area, 0.0)) * templateNorm;
+				const double numerator = correlations[static_cast<size_t>(d)];
+				double correlation;
+				if (std::abs(numerator) < norm) {
+					correlation = numerator / norm;
+				}
+				else if (std::abs(numerator) < norm * 1.125) {
+					correlation = numerator > 0 ? 1.0 : -1.0;
+				}
+				else {
+					correlation = 0.0;
+				}
+				correlations[static_cast<size_t>(d)] = static_cast<float>(correlation);
+			}
+		}
+
+		// Softmax score
+		float exponentSum = 0.f;
+		for (const float correlation : correlations) {
+			exponentSum += std::exp(correlation * 20.f);
+		}
+		const float meanProbability = 1.f / static_cast<float>(positions);
+
+		// Disparity value at maximum probability
+		int32_t disparity = 0;
+		float probability = -1.f;
+		float variance    = 0.f;
+		for (int d = 0; d < positions; d++) {
+			const float value = std::exp(correlations[static_cast<size_t>(d)] * 20.f) / exponentSum;
+			if (value > probability) {
+				probability = value;
+				disparity   = d;
+			}
+			variance += (value - meanProbability) * (value - meanProbability);
+		}
+		const float stddev = std::sqrt(variance / static_cast<float>(positions));
+
+		const float correlation = correlations[static_cast<size_t>(disparity)];
+		// If standard deviation close to zero, override score to zero since this assigns high zscores on
+		// noise
+		const float score = stddev < 0.1f ? 0.f : (probability - meanProbability) / stddev;
+
+		// Actual disparity value corrected to the search space configuration
+		const int32_t disparityValue = (imageRect.width - width) - disparity + mMinDisparity;
+		result = PixelDisparity(result.coordinates, score >= mMinScore, correlation, score, disparityValue, pixel,
+			cv::Point2i(pixel.x - disparityValue, pixel.y));
+	}
 };
 
 } // namespace dv
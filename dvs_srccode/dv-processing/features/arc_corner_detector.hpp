@@ -7,6 +7,9 @@
 #include <Eigen/Dense>
 #include <opencv2/core.hpp>
 
+#include <array>
+#include <utility>
+
 namespace dv::features {
 
 /**
@@ -49,8 +52,8 @@ public:
     },
 		mCornerRange{range},
 		mResetTsAfterDetection{resetTsAtEachIteration},
-		mCircles{CircularTimeSurfaceView{internal::CircleCoordinates<std::min(radius1, radius2)>::coords},
-			CircularTimeSurfaceView{internal::CircleCoordinates<std::max(radius1, radius2)>::coords}},
+		mCircles{CircleOffsets{internal::CircleCoordinates<std::min(radius1, radius2)>::coords},
+			CircleOffsets{internal::CircleCoordinates<std::max(radius1, radius2)>::coords}},
 		mArcLimits{{ArcLimits{internal::CircleCoordinates<std::min(radius1, radius2)>::coords.size()},
 			ArcLimits{internal::CircleCoordinates<std::max(radius1, radius2)>::coords.size()}}} {
 	}
@@ -80,41 +83,45 @@ public:
 			mTimeSurfaces[1].reset();
 		}
 
+		// Events closer to the border than the outer circle radius are not evaluated, so the circle offsets never
+		// address outside of the time surface
+		const cv::Rect region = roi
+							  & cv::Rect(MaxRadius, MaxRadius, mTimeSurfaces[0].cols() - 2 * MaxRadius,
+								  mTimeSurfaces[0].rows() - 2 * MaxRadius);
+		if (!region.empty()) {
+			updateCircleOffsets();
+		}
+
+		std::array<int64_t, MaxCircumference> ring;
+
 		for (const auto &event : events) {
-			if (roi.contains(cv::Point2i(event.x(), event.y()))
-				&& (mask.empty() || mask.at<uint8_t>(event.y(), event.x()) != 0)
-				&& cv::Rect(
-					radius2, radius2, mTimeSurfaces[0].cols() - 2 * radius2, mTimeSurfaces[0].rows() - 2 * radius2)
-					   .contains(cv::Point2i(event.x(), event.y()))) {
-				float response = 0.0f;
-				bool isCorner  = false;
-
-				for (uint8_t i = 0; i < mCircles.size(); i++) {
-					const auto &circle    = mCircles[i];
-					const auto &arcLimits = mArcLimits[i];
+			auto &timeSurface = mTimeSurfaces[static_cast<size_t>(event.polarity())];
+
+			if (region.contains(cv::Point2i(event.x(), event.y()))
+				&& (mask.empty() || mask.at<uint8_t>(event.y(), event.x()) != 0)) {
+				const auto *center = &std::as_const(timeSurface)(event.y(), event.x());
+				float response     = 0.0f;
+				bool isCorner      = false;
+
+				// Circles are evaluated from the inner one, a rejection by the inner circle skips the outer one
+				for (size_t i = 0; i < mCircles.size(); i++) {
+					const auto &circle = mCircles[i];
+					const size_t size  = circle.size();
+
 					// Definition of a corner: An arc of size x where all timestamps that are outside thereof are no
 					// greater than the minimum timestamp inside the arc
 					//
 					// Therefore we find the maximum timestamp first, so we know that an arc must contain this
 					// element
-					const auto maxTimestampLoc = std::max_element(circle.mCoords.begin(), circle.mCoords.end(),
-						[&circle, &event, this](const auto &circleCoord1, const auto &circleCoord2) {
-							return circle.getTimestamp(
-									   event, circleCoord1, mTimeSurfaces[static_cast<size_t>(event.polarity())])
-								 < circle.getTimestamp(
-									 event, circleCoord2, mTimeSurfaces[static_cast<size_t>(event.polarity())]);
-						});
-
-					const auto maxTimestampValue = circle.getTimestamp(
-						event, *maxTimestampLoc, mTimeSurfaces[static_cast<size_t>(event.polarity())]);
+					const auto [maxTimestampIndex, maxTimestampValue] = gatherRing(center, circle, ring);
 
 					if (maxTimestampValue != 0) {
 						const auto [arcSize, arcBegin, arcEnd, minTimestampInArc]
-							= expandArc(maxTimestampLoc, maxTimestampValue, event, circle);
+							= expandArc(ring, size, maxTimestampIndex, maxTimestampValue);
 
-						if (arcLimits.satisfied(arcSize)) {
+						if (mArcLimits[i].satisfied(arcSize)) {
 							const auto maxTimestampOutsideArc
-								= checkSurroundingTimestamps(arcBegin, arcEnd, minTimestampInArc, event, circle);
+								= checkSurroundingTimestamps(ring, size, arcBegin, arcEnd, minTimestampInArc);
 
 							if (minTimestampInArc > maxTimestampOutsideArc) {
 								response += static_cast<float>(minTimestampInArc - maxTimestampOutsideArc)
@@ -141,7 +148,7 @@ public:
 				}
 			}
 
-			mTimeSurfaces[static_cast<int32_t>(event.polarity())] << event;
+			timeSurface << event;
 		}
 
 		return corners;
@@ -157,40 +164,63 @@ public:
 	}
 
 private:
+	static constexpr int32_t MaxRadius = static_cast<int32_t>(std::max(radius1, radius2));
+
+	/**
+	 * Upper bound on the number of coordinates on a supported circle.
+	 */
+	static constexpr size_t MaxCircumference = 64;
+
 	std::array<TimeSurface, 2> mTimeSurfaces;
 	int64_t mCornerRange;
 	bool mResetTsAfterDetection;
 
-	class CircularTimeSurfaceView {
+	/**
+	 * Circle coordinates converted into linear offsets from the center element in the time surface storage, so
+	 * the ring around an event is addressed without any coordinate arithmetic.
+	 */
+	class CircleOffsets {
 	public:
 		using CoordVector = std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i>>;
 
-		explicit CircularTimeSurfaceView(CoordVector &coords) : mCoords{coords.begin(), coords.end()} {
+		explicit CircleOffsets(const CoordVector &coords) : mCoords{coords.begin(), coords.end()} {
+			dv::runtime_assert(mCoords.size() <= MaxCircumference, "Circle has too many coordinates");
 		}
 
-		explicit CircularTimeSurfaceView(CoordVector &&coords) : mCoords{coords.begin(), coords.end()} {
-		}
-
-		[[nodiscard]] auto getTimestamp(
-			const dv::Event &e, const Eigen::Vector2i &circleCoords, const TimeSurface &ts) const {
-			return ts(e.y() + circleCoords.y(), e.x() + circleCoords.x());
+		/**
+		 * Recompute the linear offsets if the storage strides have changed.
+		 * @param strideX distance between horizontally neighbouring elements
+		 * @param strideY distance between vertically neighbouring elements
+		 */
+		void update(const ptrdiff_t strideX, const ptrdiff_t strideY) {
+			if (mOffsets.size() == mCoords.size() && strideX == mStrideX && strideY == mStrideY) {
+				return;
+			}
+			mStrideX = strideX;
+			mStrideY = strideY;
+			mOffsets.resize(mCoords.size());
+			for (size_t i = 0; i < mCoords.size(); i++) {
+				mOffsets[i] = static_cast<ptrdiff_t>(mCoords[i].x()) * strideX
+							+ static_cast<ptrdiff_t>(mCoords[i].y()) * strideY;
+			}
 		}
 
-		template<typename ITERATOR>
-		[[nodiscard]] auto circularIncrement(const ITERATOR it) const {
-			const auto incremented = it + 1;
-			return incremented == mCoords.end() ? mCoords.begin() : incremented;
+		[[nodiscard]] size_t size() const {
+			return mCoords.size();
 		}
 
-		template<typename ITERATOR>
-		[[nodiscard]] auto circularDecrement(const ITERATOR it) const {
-			return it == mCoords.begin() ? mCoords.end() - 1 : it - 1;
+		[[nodiscard]] const ptrdiff_t *offsets() const {
+			return mOffsets.data();
 		}
 
+	private:
 		CoordVector mCoords;
+		std::vector<ptrdiff_t> mOffsets;
+		ptrdiff_t mStrideX = 0;
+		ptrdiff_t mStrideY = 0;
 	};
 
-	std::array<CircularTimeSurfaceView, 2> mCircles;
+	std::array<CircleOffsets, 2> mCircles;
 
 	class ArcLimits {
 	public:
@@ -218,19 +248,66 @@ private:
 
 	std::array<ArcLimits, 2> mArcLimits;
 
-	[[nodiscard]] auto insideCorner(const int64_t ts1, const int64_t ts2) {
+	/**
+	 * Update circle offsets to the storage layout of the time surfaces. Both time surfaces share the same
+	 * dimensions, so the layout is taken from the first one.
+	 */
+	void updateCircleOffsets() {
+		const auto &surface     = std::as_const(mTimeSurfaces[0]);
+		const auto *origin      = &surface(0, 0);
+		const ptrdiff_t strideX = &surface(0, 1) - origin;
+		const ptrdiff_t strideY = &surface(1, 0) - origin;
+		for (auto &circle : mCircles) {
+			circle.update(strideX, strideY);
+		}
+	}
+
+	/**
+	 * Gather timestamps on a circle into a contiguous ring buffer and find the first maximum timestamp.
+	 * @param center pointer to the time surface element of the circle center
+	 * @param circle circle offsets
+	 * @param ring output ring buffer
+	 * @return index and value of the maximum timestamp on the ring
+	 */
+	[[nodiscard]] static std::pair<size_t, int64_t> gatherRing(const typename TimeSurface::Scalar *center,
+		const CircleOffsets &circle, std::array<int64_t, MaxCircumference> &ring) {
+		const ptrdiff_t *offsets = circle.offsets();
+		const size_t size        = circle.size();
+		for (size_t i = 0; i < size; i++) {
+			ring[i] = static_cast<int64_t>(center[offsets[i]]);
+		}
+
+		size_t maxIndex  = 0;
+		int64_t maxValue = ring[0];
+		for (size_t i = 1; i < size; i++) {
+			if (ring[i] > maxValue) {
+				maxValue = ring[i];
+				maxIndex = i;
+			}
+		}
+		return {maxIndex, maxValue};
+	}
+
+	[[nodiscard]] auto insideCorner(const int64_t ts1, const int64_t ts2) const {
 		return std::abs(ts1 - ts2) < mCornerRange;
 	}
 
-	template<typename ITERATOR>
-	[[nodiscard]] auto expandArc(const ITERATOR &maxTimestampLoc, const int64_t maxTimestampValue,
-		const dv::Event &event, const CircularTimeSurfaceView &circle) {
+	[[nodiscard]] static size_t ringIncrement(const size_t index, const size_t size) {
+		return index + 1 == size ? 0 : index + 1;
+	}
+
+	[[nodiscard]] static size_t ringDecrement(const size_t index, const size_t size) {
+		return index == 0 ? size - 1 : index - 1;
+	}
+
+	[[nodiscard]] auto expandArc(const std::array<int64_t, MaxCircumference> &ring, const size_t size,
+		const size_t maxTimestampIndex, const int64_t maxTimestampValue) const {
 		// start at the max timestamp, as the arc must contain this element
-		auto arcBegin = maxTimestampLoc;
-		auto arcEnd   = maxTimestampLoc;
+		size_t arcBegin = maxTimestampIndex;
+		size_t arcEnd   = maxTimestampIndex;
 
 		// As the maximum timestamp is included in the arc by default, the initial arc size is 1
-		int16_t arcSize = 1;
+		size_t arcSize = 1;
 
 		auto minTimestampInArc = maxTimestampValue;
 
@@ -239,15 +316,12 @@ private:
 
 		do {
 			if (!beginFound) {
-				const auto beginCandidate = circle.circularDecrement(arcBegin);
-				const auto beginCandidateValue
-					= circle.getTimestamp(event, *beginCandidate, mTimeSurfaces[static_cast<size_t>(event.polarity())]);
+				const size_t beginCandidate = ringDecrement(arcBegin, size);
 
-				if (insideCorner(beginCandidateValue, minTimestampInArc)) {
+				if (insideCorner(ring[beginCandidate], minTimestampInArc)) {
 					arcBegin = beginCandidate;
 					arcSize++;
-					minTimestampInArc
-						= std::min(static_cast<int64_t>(beginCandidateValue), static_cast<int64_t>(minTimestampInArc));
+					minTimestampInArc = std::min(ring[beginCandidate], minTimestampInArc);
 				}
 				else {
 					beginFound = true;
@@ -255,39 +329,31 @@ private:
 			}
 
 			if (!endFound) {
-				const auto endCandidate = circle.circularIncrement(arcEnd);
-				const auto endCandidateValue
-					= circle.getTimestamp(event, *endCandidate, mTimeSurfaces[static_cast<size_t>(event.polarity())]);
+				const size_t endCandidate = ringIncrement(arcEnd, size);
 
-				if (insideCorner(endCandidateValue, minTimestampInArc)) {
+				if (insideCorner(ring[endCandidate], minTimestampInArc)) {
 					arcEnd = endCandidate;
 					arcSize++;
-					minTimestampInArc
-						= std::min(static_cast<int64_t>(endCandidateValue), static_cast<int64_t>(minTimestampInArc));
+					minTimestampInArc = std::min(ring[endCandidate], minTimestampInArc);
 				}
 				else {
 					endFound = true;
 				}
 			}
 		}
-		while ((arcSize < circle.mCoords.size()) && !(beginFound && endFound) && (arcBegin != arcEnd));
+		while ((arcSize < size) && !(beginFound && endFound) && (arcBegin != arcEnd));
 
 		return std::make_tuple(arcSize, arcBegin, arcEnd, minTimestampInArc);
 	}
 
-	template<typename ITERATOR>
-	[[nodiscard]] auto checkSurroundingTimestamps(const ITERATOR &arcBegin, const ITERATOR arcEnd,
-		const int64_t minTimestampInArc, const dv::Event &event, const CircularTimeSurfaceView &circle) {
+	[[nodiscard]] static int64_t checkSurroundingTimestamps(const std::array<int64_t, MaxCircumference> &ring,
+		const size_t size, const size_t arcBegin, const size_t arcEnd, const int64_t minTimestampInArc) {
 		auto maxTimestampOutsideArc = std::numeric_limits<int64_t>::min();
 
-		for (auto it = circle.circularIncrement(arcEnd); it != arcBegin; it = circle.circularIncrement(it)) {
-			const auto timestamp
-				= circle.getTimestamp(event, *it, mTimeSurfaces[static_cast<size_t>(event.polarity())]);
-
-			maxTimestampOutsideArc
-				= std::max(static_cast<int64_t>(timestamp), static_cast<int64_t>(maxTimestampOutsideArc));
+		for (size_t i = ringIncrement(arcEnd, size); i != arcBegin; i = ringIncrement(i, size)) {
+			maxTimestampOutsideArc = std::max(ring[i], maxTimestampOutsideArc);
 
-			if (timestamp > minTimestampInArc) {
+			if (ring[i] > minTimestampInArc) {
 				break;
 			}
 		}
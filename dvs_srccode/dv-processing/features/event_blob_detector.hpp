@@ -3,19 +3,46 @@
 #include "../core/event.hpp"
 #include "../core/frame/accumulator.hpp"
 #include "../data/utilities.hpp"
+#include "../exception/exceptions/generic_exceptions.hpp"
 
 #include <opencv2/opencv.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <limits>
+#include <numbers>
+#include <optional>
 #include <utility>
+#include <vector>
 
 namespace dv::features {
 
 /**
- * Event-based blob detector performing detection on accumulated event images.
+ * Event-based blob detector performing detection on accumulated event images, or directly on a downsampled event
+ * occupancy grid.
  */
 class EventBlobDetector {
 public:
+	/**
+	 * Parameters of the event-native detection on an occupancy grid.
+	 */
+	struct OccupancyGridParams {
+		/**
+		 * Minimum average number of events per pixel in a grid cell for the cell to be occupied.
+		 */
+		float minDensity = 0.5f;
+
+		/**
+		 * Minimum number of occupied grid cells of a blob.
+		 */
+		int32_t minArea = 10;
+
+		/**
+		 * Maximum number of occupied grid cells of a blob.
+		 */
+		int32_t maxArea = 10000;
+	};
+
 	/**
 	 * Create a reasonable default blob detector.
 	 *
@@ -72,7 +99,34 @@ public:
 		mBlobDetector(std::move(blobDetector)),
 		mPyramidLevel(pyramidLevel),
 		mPreprocessFcn(std::move(preprocess)),
-		mAccumulator(resolution) {
+		mAccumulator(resolution),
+		mResolution(resolution) {
+	}
+
+	/**
+	 * Constructor for event-native blob detector.
+	 *
+	 * Instead of accumulating an image, events are binned directly into an occupancy grid with cells of
+	 * 2^pyramidLevel x 2^pyramidLevel pixels, which matches the image resolution of the given pyramid level.
+	 * A cell is occupied if its average number of events per pixel reaches `params.minDensity`. Blobs are the
+	 * 8-connected components of occupied cells, found in a single raster pass over the grid, with area within
+	 * `[params.minArea; params.maxArea]` cells. Blob location is the centroid of the events within the blob
+	 * cells, size is the diameter of a circle with the blob area and response is the number of events in the
+	 * blob. Blobs where mask value is 0 are removed.
+	 *
+	 * @param resolution original image plane resolution
+	 * @param pyramidLevel integer defining the size of grid cells, same as the number of down samples in the
+	 * 					   accumulated image detection.
+	 * @param params occupancy grid detection parameters
+	 */
+	EventBlobDetector(const cv::Size &resolution, const int pyramidLevel, const OccupancyGridParams &params) :
+		mPyramidLevel(pyramidLevel),
+		mAccumulator(resolution),
+		mResolution(resolution),
+		mOccupancyParams(params) {
+		if (pyramidLevel < 0) {
+			throw dv::exceptions::InvalidArgument<int>("Pyramid level must be non-negative", pyramidLevel);
+		}
 	}
 
 	/**
@@ -89,6 +143,10 @@ public:
 			return {};
 		}
 
+		if (mOccupancyParams.has_value()) {
+			return detectOccupancyBlobs(events, roi, mask);
+		}
+
 		mAccumulator.accept(events);
 
 		// create event image
@@ -166,6 +224,167 @@ private:
 	 * Accumulator generating the image used for blob detection
 	 */
 	dv::EdgeMapAccumulator mAccumulator;
+
+	cv::Size mResolution;
+
+	/**
+	 * Parameters of event-native detection, accumulated image detection is used if not set
+	 */
+	std::optional<OccupancyGridParams> mOccupancyParams = std::nullopt;
+
+	/**
+	 * Per-cell event counts of the occupancy grid, saturated at the 16-bit range
+	 */
+	std::vector<uint16_t> mCellEvents;
+
+	/**
+	 * Connected component labels of grid cells, union-find parents and per-component statistics
+	 */
+	std::vector<int32_t> mLabels;
+	std::vector<int32_t> mParents;
+	std::vector<int32_t> mLabelArea;
+	std::vector<int64_t> mLabelEvents;
+	std::vector<int64_t> mLabelSumX;
+	std::vector<int64_t> mLabelSumY;
+
+	[[nodiscard]] int32_t findRoot(int32_t label) {
+		while (mParents[static_cast<size_t>(label)] != label) {
+			// Path halving
+			mParents[static_cast<size_t>(label)]
+				= mParents[static_cast<size_t>(mParents[static_cast<size_t>(label)])];
+			label = mParents[static_cast<size_t>(label)];
+		}
+		return label;
+	}
+
+	int32_t unite(const int32_t a, const int32_t b) {
+		const int32_t rootA = findRoot(a);
+		const int32_t rootB = findRoot(b);
+		const int32_t root  = std::min(rootA, rootB);
+		mParents[static_cast<size_t>(rootA)] = root;
+		mParents[static_cast<size_t>(rootB)] = root;
+		return root;
+	}
+
+	/**
+	 * Event-native detection step, @sa EventBlobDetector(const cv::Size &, const int, const OccupancyGridParams &)
+	 */
+	[[nodiscard]] dv::cvector<dv::TimedKeyPoint> detectOccupancyBlobs(
+		const dv::EventStore &events, const cv::Rect &roi, const cv::Mat &mask) {
+		const cv::Rect region = roi.area() > 0 ? (roi & cv::Rect(cv::Point(0, 0), mResolution))
+											   : cv::Rect(cv::Point(0, 0), mResolution);
+		const int cellSize    = 1 << mPyramidLevel;
+		const int gridWidth   = (region.width + cellSize - 1) / cellSize;
+		const int gridHeight  = (region.height + cellSize - 1) / cellSize;
+		const auto numCells   = static_cast<size_t>(gridWidth) * static_cast<size_t>(gridHeight);
+
+		mCellEvents.assign(numCells, 0);
+
+		const auto cellOf = [&](const dv::Event &event) -> std::optional<size_t> {
+			const int x = event.x() - region.x;
+			const int y = event.y() - region.y;
+			if (x < 0 || y < 0 || x >= region.width || y >= region.height) {
+				return std::nullopt;
+			}
+			return static_cast<size_t>(y >> mPyramidLevel) * static_cast<size_t>(gridWidth)
+				 + static_cast<size_t>(x >> mPyramidLevel);
+		};
+
+		// Bin the events into grid cells
+		for (const auto &event : events) {
+			if (const auto cell = cellOf(event); cell.has_value()) {
+				mCellEvents[*cell] += static_cast<uint16_t>(mCellEvents[*cell] < std::numeric_limits<uint16_t>::max());
+			}
+		}
+
+		const auto minCellEvents = static_cast<uint16_t>(std::clamp(
+			std::ceil(mOccupancyParams->minDensity * static_cast<float>(cellSize * cellSize)), 1.f, 65535.f));
+
+		// Single raster pass labelling 8-connected occupied cells, equivalent labels are merged with union-find
+		mLabels.resize(numCells);
+		mParents.clear();
+		mLabelArea.clear();
+		for (int gy = 0; gy < gridHeight; gy++) {
+			for (int gx = 0; gx < gridWidth; gx++) {
+				const size_t cell = static_cast<size_t>(gy) * static_cast<size_t>(gridWidth) + static_cast<size_t>(gx);
+				if (mCellEvents[cell] < minCellEvents) {
+					mLabels[cell] = -1;
+					continue;
+				}
+
+				int32_t label    = -1;
+				const auto visit = [&](const int nx, const int ny) {
+					if (nx < 0 || ny < 0 || nx >= gridWidth) {
+						return;
+					}
+					const int32_t neighbour
+						= mLabels[static_cast<size_t>(ny) * static_cast<size_t>(gridWidth) + static_cast<size_t>(nx)];
+					if (neighbour >= 0) {
+						label = (label < 0) ? findRoot(neighbour) : unite(label, neighbour);
+					}
+				};
+				visit(gx - 1, gy);
+				visit(gx - 1, gy - 1);
+				visit(gx, gy - 1);
+				visit(gx + 1, gy - 1);
+
+				if (label < 0) {
+					label = static_cast<int32_t>(mParents.size());
+					mParents.push_back(label);
+					mLabelArea.push_back(0);
+				}
+
+				mLabels[cell] = label;
+				mLabelArea[static_cast<size_t>(label)]++;
+			}
+		}
+
+		// Resolve every label to its component root and merge the areas
+		for (size_t label = 0; label < mParents.size(); label++) {
+			const auto root  = static_cast<size_t>(findRoot(static_cast<int32_t>(label)));
+			mParents[label] = static_cast<int32_t>(root);
+			if (root != label) {
+				mLabelArea[root] += mLabelArea[label];
+			}
+		}
+
+		// Accumulate event centroids of the components in a second pass over the events
+		mLabelEvents.assign(mParents.size(), 0);
+		mLabelSumX.assign(mParents.size(), 0);
+		mLabelSumY.assign(mParents.size(), 0);
+		for (const auto &event : events) {
+			if (const auto cell = cellOf(event); cell.has_value() && mLabels[*cell] >= 0) {
+				const auto root = static_cast<size_t>(mParents[static_cast<size_t>(mLabels[*cell])]);
+				mLabelEvents[root]++;
+				mLabelSumX[root] += event.x() - region.x;
+				mLabelSumY[root] += event.y() - region.y;
+			}
+		}
+
+		const int64_t timestamp = events.getLowestTime();
+		const auto cellArea     = static_cast<float>(cellSize * cellSize);
+		dv::cvector<dv::TimedKeyPoint> blobs;
+		for (size_t label = 0; label < mParents.size(); label++) {
+			if (mParents[label] != static_cast<int32_t>(label) || mLabelArea[label] < mOccupancyParams->minArea
+				|| mLabelArea[label] > mOccupancyParams->maxArea) {
+				continue;
+			}
+
+			const auto count = static_cast<double>(mLabelEvents[label]);
+			const auto x     = static_cast<float>(static_cast<double>(mLabelSumX[label]) / count + region.x);
+			const auto y     = static_cast<float>(static_cast<double>(mLabelSumY[label]) / count + region.y);
+
+			if (!mask.empty() && mask.at<uint8_t>(static_cast<int>(y), static_cast<int>(x)) == 0) {
+				continue;
+			}
+
+			const float diameter
+				= 2.f * std::sqrt(static_cast<float>(mLabelArea[label]) * cellArea / std::numbers::pi_v<float>);
+			blobs.emplace_back(dv::Point2f(x, y), diameter, -1.f, static_cast<float>(count), 0, -1, timestamp);
+		}
+
+		return blobs;
+	}
 };
 
 static_assert(dv::concepts::DVFeatureDetectorAlgorithm<dv::features::EventBlobDetector, dv::EventStore>);
@@ -27,20 +27,23 @@ protected:
 
 	std::vector<std::vector<cv::Point2f>> mEventTrackPoints;
 
+	// Scratch buffers for intermediate tracking, kept to reuse their capacity between frames
+	std::vector<cv::Point2f> mIntermediatePoints;
+	std::vector<unsigned char> mIntermediateStatus;
+	std::vector<float> mIntermediateErrors;
+
 	/**
-	 * Run the intermediate tracking on accumulated events. The lastFrameResults are modified if any of
-	 * the intermediate tracks are lost. The predicted coordinates are returned which must match the indices
-	 * of the keypoints in lastFrameResults keypoint list.
-	 * @return      Predicted feature track locations that correspond to modified `lastFrameResults->keypoints`
-	 * 				vector.
+	 * Run the intermediate tracking on accumulated events. The predicted coordinates are written into
+	 * `mPredictedPoints`, their indices match the keypoints in lastFrameResults keypoint list. Expects
+	 * `mPreviousPoints` to be loaded from lastFrameResults.
 	 */
-	std::vector<cv::Point2f> trackIntermediateEvents() {
+	void trackIntermediateEvents() {
 		mAccumulatedFrames.clear();
 		mEventTrackPoints.clear();
-		std::vector<cv::Point2f> prevPoints = dv::data::convertToCvPoints(lastFrameResults->keypoints);
+		mPredictedPoints.assign(mPreviousPoints.begin(), mPreviousPoints.end());
 
 		if (mEventBuffer.isEmpty()) {
-			return prevPoints;
+			return;
 		}
 
 		int64_t framePeriod        = mCurrentFrame->timestamp - lastFrameResults->timestamp;
@@ -54,30 +57,27 @@ protected:
 			mAccumulatedFrames.emplace_back(
 				generationTime, frame.image, mConfig.searchWindowSize, mConfig.numPyrLayers);
 		}
-		std::vector<cv::Point2f> currentPoints;
-		std::vector<unsigned char> status;
-		std::vector<float> err;
 		auto prevFrame = mAccumulatedFrames.begin();
 		for (auto nextFrame = mAccumulatedFrames.begin() + 1; nextFrame < mAccumulatedFrames.end();
 			 nextFrame++, prevFrame++) {
-			currentPoints = prevPoints;
-			if (prevPoints.empty()) {
+			mIntermediatePoints.assign(mPredictedPoints.begin(), mPredictedPoints.end());
+			if (mPredictedPoints.empty()) {
 				// No more points to track
 				continue;
 			}
-			mTracker->calc(prevFrame->pyramid, nextFrame->pyramid, prevPoints, currentPoints, status, err);
-			for (size_t i = 0; i < status.size(); i++) {
-				const auto &kpt = currentPoints[i];
-				if (status[i] == 1 && mDetector->isWithinROI(kpt)) {
+			trackPoints(*prevFrame, *nextFrame, mPredictedPoints, mIntermediatePoints, mIntermediateStatus,
+				mIntermediateErrors, false);
+			for (size_t i = 0; i < mIntermediateStatus.size(); i++) {
+				const auto &kpt = mIntermediatePoints[i];
+				if (mIntermediateStatus[i] == 1 && mDetector->isWithinROI(kpt)) {
 					// Replace prediction with newly tracked location
-					prevPoints[i] = kpt;
+					mPredictedPoints[i] = kpt;
 				}
 			}
-			mEventTrackPoints.push_back(prevPoints);
+			mEventTrackPoints.push_back(mPredictedPoints);
 		}
-		dv::runtime_assert(lastFrameResults->keypoints.size() == prevPoints.size(),
+		dv::runtime_assert(lastFrameResults->keypoints.size() == mPredictedPoints.size(),
 			"Predicted points contains less features than the lastFrameResults");
-		return prevPoints;
 	}
 
 	/**
@@ -91,62 +91,43 @@ protected:
 
 		// Initialize if we do not have any features
 		if (!mPreviousFrame || lastFrameResults->keypoints.empty()) {
-			TrackerBase::Result::SharedPtr result = std::make_shared<TrackerBase::Result>(
-				mCurrentFrame->timestamp, mDetector->runDetection(*mCurrentFrame, maxTracks), true);
+			auto result         = acquireResult(mCurrentFrame->timestamp, true);
+			const auto detected = mDetector->runDetection(*mCurrentFrame, maxTracks);
+			// Copy into the pooled buffer instead of move-assigning to keep its reserved capacity
+			result->keypoints.assign(detected);
 			mPreviousFrame = std::move(mCurrentFrame);
 			return result;
 		}
 
 		// Perform LK tracking
-		std::vector<unsigned char> status;
-		std::vector<float> err;
-
-		std::vector<cv::Point2f> predictedKpts;
-		std::vector<cv::Point2f> previousKpts = dv::data::convertToCvPoints(lastFrameResults->keypoints);
+		loadPreviousPoints();
 		if (mEventBuffer.sliceTime(mPreviousFrame->timestamp, mCurrentFrame->timestamp).rate()
 			> mMinRateForIntermediateTracking) {
-			predictedKpts = trackIntermediateEvents();
+			trackIntermediateEvents();
 		}
 		else {
-			predictedKpts = previousKpts;
+			mPredictedPoints.assign(mPreviousPoints.begin(), mPreviousPoints.end());
 		}
 
-		mTracker->calc(mPreviousFrame->pyramid, mCurrentFrame->pyramid, previousKpts, predictedKpts, status, err);
+		trackPoints(
+			*mPreviousFrame, *mCurrentFrame, mPreviousPoints, mPredictedPoints, mTrackStatus, mTrackErrors, false);
 
 		// Fill in the keypoints
-		dv::cvector<dv::TimedKeyPoint> keyPoints;
-		for (size_t i = 0; i < predictedKpts.size(); i++) {
-			// Select good points
-			const auto &kpt = predictedKpts[i];
-
-			if (status[i] == 1 && mDetector->isWithinROI(kpt)) {
-				const auto &feat = lastFrameResults->keypoints[i];
-				keyPoints.emplace_back(dv::Point2f(kpt.x, kpt.y), feat.size, feat.angle, err[i], feat.octave,
-					feat.class_id, mCurrentFrame->timestamp);
-			}
-		}
-
-		bool asKeyframe = false;
+		auto result = acquireResult(mCurrentFrame->timestamp, false);
+		collectTrackedPoints(*result);
 
 		// Decide on redetection of features
 		if (mRedetectionStrategy->decideRedetection(*this)) {
-			cv::Mat mask;
-			if (mConfig.maskedFeatureDetect) {
-				// Disable search on locations where we already have features
-				mask = cv::Mat(mCurrentFrame->pyramid.at(0).size(), CV_8UC1, cv::Scalar(255));
-				for (const auto &feat : keyPoints) {
-					cv::circle(mask, cv::Point2f(feat.pt.x(), feat.pt.y()), static_cast<int>(std::ceil(feat.size)),
-						cv::Scalar(0), -1, cv::LINE_4);
-				}
-			}
+			// Disable search on locations where we already have features
+			const cv::Mat mask
+				= mConfig.maskedFeatureDetect ? prepareDetectionMask(result->keypoints, 1.f, cv::LINE_4) : cv::Mat();
 			// Detect new features
-			std::vector<cv::Point2f> pts;
-			mDetector->runRedetection(keyPoints, *mCurrentFrame, maxTracks, mask);
-			asKeyframe = true;
+			mDetector->runRedetection(result->keypoints, *mCurrentFrame, maxTracks, mask);
+			result->asKeyFrame = true;
 		}
 
 		mPreviousFrame = std::move(mCurrentFrame);
-		return std::make_shared<TrackerBase::Result>(mPreviousFrame->timestamp, keyPoints, asKeyframe);
+		return result;
 	}
 
 	/**
@@ -0,0 +1,519 @@
+#pragma once
+
+#include "../core/frame.hpp"
+#include "image_feature_lk_tracker.hpp"
+
+namespace dv::features {
+
+/**
+ * Event-based sparse Lucas-Kanade tracker which does not accumulate full frames for tracking. Events of each
+ * tracking step are bucketed into a coarse spatial grid, for each tracked keypoint only a small local patch of
+ * events around it is rendered from the neighbouring buckets and LK tracking is performed on these patches only.
+ * A full sensor sized frame is accumulated only when features need to be (re)detected.
+ *
+ * The patches are rendered the same way as `dv::EdgeMapAccumulator` with default parameters renders a frame
+ * (polarity ignored, full decay, configurable event contribution), so tracking behaves like
+ * `EventFeatureLKTracker::RegularTracker`, but the cost of a tracking step scales with the number of events and
+ * the number of tracks instead of the sensor resolution. This is beneficial in sparse scenes, where the total
+ * area of all patches is well below the sensor area.
+ *
+ * Same as with other event trackers, the tracking function should be executed on a loop until it returns a
+ * null-pointer, signifying end of available data processing:
+ * ```
+ * tracker.accept(eventStore);
+ * while (auto result = tracker.runTracking()) {
+ *     // process the tracking result
+ * }
+ *```
+ */
+class EventPatchLKTracker : public TrackerBase {
+public:
+	using Config    = LucasKanadeConfig;
+	using SharedPtr = std::shared_ptr<EventPatchLKTracker>;
+	using UniquePtr = std::unique_ptr<EventPatchLKTracker>;
+
+protected:
+	/**
+	 * Event coordinates sorted into square grid cells, stored in a flat buffer with per cell offsets.
+	 */
+	struct EventBuckets {
+		/**
+		 * Index of the first coordinate of each cell, contains one additional trailing value.
+		 */
+		std::vector<uint32_t> offsets;
+
+		/**
+		 * Event coordinates, ordered by cell index.
+		 */
+		std::vector<cv::Point_<int16_t>> coordinates;
+
+		/**
+		 * Sort event coordinates into cells using a counting sort. Buffers are reused between calls.
+		 * @param events        Events to be bucketed.
+		 * @param cellSize      Size of a cell side in pixels.
+		 * @param gridSize      Number of cells in horizontal and vertical direction.
+		 */
+		void build(const dv::EventStore &events, const int cellSize, const cv::Size &gridSize) {
+			offsets.assign(static_cast<size_t>(gridSize.area()) + 1, 0);
+			coordinates.resize(events.size());
+
+			for (const auto &event : events) {
+				offsets[cellIndex(event.x(), event.y(), cellSize, gridSize) + 1]++;
+			}
+
+			for (size_t i = 1; i < offsets.size(); i++) {
+				offsets[i] += offsets[i - 1];
+			}
+
+			// Use the offsets as insertion cursors and shift them back afterwards
+			for (const auto &event : events) {
+				const size_t cell            = cellIndex(event.x(), event.y(), cellSize, gridSize);
+				coordinates[offsets[cell]++] = cv::Point_<int16_t>(event.x(), event.y());
+			}
+
+			for (size_t i = offsets.size() - 1; i > 0; i--) {
+				offsets[i] = offsets[i - 1];
+			}
+			offsets[0] = 0;
+		}
+
+		[[nodiscard]] static size_t cellIndex(const int16_t x, const int16_t y, const int cellSize,
+			const cv::Size &gridSize) {
+			return static_cast<size_t>((y / cellSize) * gridSize.width + (x / cellSize));
+		}
+	};
+
+	Config mConfig = {};
+
+	RedetectionStrategy::UniquePtr mRedetectionStrategy = nullptr;
+
+	ImagePyrFeatureDetector::UniquePtr mDetector = nullptr;
+
+	cv::Size mResolution;
+
+	int mFramerate            = 50;
+	int64_t mPeriod           = 1000000 / mFramerate;
+	int64_t mLastRunTimestamp = 0;
+
+	dv::Duration mStoreTimeLimit = dv::Duration(5000000);
+
+	/**
+	 * The default number of event is a third of of total pixels in the sensor.
+	 */
+	size_t mNumberOfEvents;
+
+	dv::EventStore mEventBuffer;
+
+	float mEventContribution = 0.25f;
+
+	uint8_t mDrawIncrement = 64;
+
+	/**
+	 * Point and status buffers reused across tracking steps.
+	 */
+	std::vector<cv::Point2f> mPoints;
+	std::vector<unsigned char> mTrackStatus;
+	std::vector<float> mTrackErrors;
+
+	/**
+	 * Redetection mask buffer reused across tracking steps.
+	 */
+	cv::Mat mDetectionMask;
+
+	int mPatchRadius = 32;
+
+	int mCellSize = 16;
+
+	cv::Size mGridSize;
+
+	EventBuckets mPreviousBuckets;
+
+	EventBuckets mCurrentBuckets;
+
+	cv::Mat mAccumulatedFrame;
+
+	/**
+	 * Render events of the given buckets that fall into the patch area into the patch image.
+	 * @param buckets       Bucketed events.
+	 * @param origin        Top-left corner of the patch in sensor coordinates.
+	 * @param patch         Output patch image, must be preallocated CV_8UC1 image.
+	 */
+	void renderPatch(const EventBuckets &buckets, const cv::Point &origin, cv::Mat &patch) const {
+		patch.setTo(0);
+		if (buckets.offsets.empty()) {
+			return;
+		}
+
+		const cv::Rect area(origin, patch.size());
+		const int cellX0 = std::max(area.x, 0) / mCellSize;
+		const int cellY0 = std::max(area.y, 0) / mCellSize;
+		const int cellX1 = std::min((area.x + area.width - 1) / mCellSize, mGridSize.width - 1);
+		const int cellY1 = std::min((area.y + area.height - 1) / mCellSize, mGridSize.height - 1);
+
+		for (int cellY = cellY0; cellY <= cellY1; cellY++) {
+			const size_t rowOffset = static_cast<size_t>(cellY * mGridSize.width);
+			const auto begin       = buckets.coordinates.begin() + buckets.offsets[rowOffset + cellX0];
+			const auto end         = buckets.coordinates.begin() + buckets.offsets[rowOffset + cellX1 + 1];
+
+			// Cells of a row are stored contiguously
+			for (auto iter = begin; iter != end; iter++) {
+				const int x = iter->x - area.x;
+				const int y = iter->y - area.y;
+				if (x < 0 || y < 0 || x >= area.width || y >= area.height) {
+					continue;
+				}
+				auto &pixel = patch.at<uint8_t>(y, x);
+				pixel       = static_cast<uint8_t>(std::min(pixel + mDrawIncrement, 255));
+			}
+		}
+	}
+
+	/**
+	 * Accumulate a full frame from the given events, it is only used for feature detection.
+	 * @param events        Events to be accumulated.
+	 * @return              Image pyramid of the accumulated frame.
+	 */
+	[[nodiscard]] ImagePyramid accumulateDetectionFrame(const dv::EventStore &events) {
+		dv::EdgeMapAccumulator accumulator(mResolution, mEventContribution);
+		accumulator.accept(events);
+		mAccumulatedFrame = accumulator.generateFrame().image;
+		return {events.getHighestTime(), mAccumulatedFrame, mConfig.searchWindowSize, mConfig.numPyrLayers - 1};
+	}
+
+	/**
+	 * Track all keypoints of the last result from the previous into the current event buckets.
+	 * @param points        Keypoint locations, replaced with tracked locations.
+	 * @param status        Output tracking status, 1 for successfully tracked points.
+	 * @param err           Output tracking error.
+	 */
+	void trackPatches(std::vector<cv::Point2f> &points, std::vector<unsigned char> &status,
+		std::vector<float> &err) const {
+		status.assign(points.size(), 0);
+		err.assign(points.size(), 0.f);
+
+		const cv::TermCriteria criteria(
+			cv::TermCriteria::COUNT + cv::TermCriteria::EPS, 30, mConfig.terminationEpsilon);
+		const int patchSize = 2 * mPatchRadius + 1;
+
+		cv::parallel_for_(cv::Range(0, static_cast<int>(points.size())), [&](const cv::Range &range) {
+			cv::Mat previousPatch(patchSize, patchSize, CV_8UC1);
+			cv::Mat currentPatch(patchSize, patchSize, CV_8UC1);
+			std::vector<cv::Point2f> from(1);
+			std::vector<cv::Point2f> to(1);
+			std::vector<unsigned char> pointStatus;
+			std::vector<float> pointErr;
+
+			for (int i = range.start; i < range.end; i++) {
+				const cv::Point origin = cv::Point(cvRound(points[i].x), cvRound(points[i].y))
+									   - cv::Point(mPatchRadius, mPatchRadius);
+
+				renderPatch(mPreviousBuckets, origin, previousPatch);
+				renderPatch(mCurrentBuckets, origin, currentPatch);
+
+				from[0] = points[i] - cv::Point2f(origin);
+				to[0]   = from[0];
+
+				cv::calcOpticalFlowPyrLK(previousPatch, currentPatch, from, to, pointStatus, pointErr,
+					mConfig.searchWindowSize, mConfig.numPyrLayers - 1, criteria, cv::OPTFLOW_USE_INITIAL_FLOW);
+
+				// Track is lost if it leaves the patch, there is no event data outside of it
+				const cv::Rect2f patchArea(0.f, 0.f, static_cast<float>(patchSize), static_cast<float>(patchSize));
+				if (pointStatus[0] == 1 && patchArea.contains(to[0])) {
+					points[i] = to[0] + cv::Point2f(origin);
+					status[i] = 1;
+					err[i]    = pointErr[0];
+				}
+			}
+		});
+	}
+
+	/**
+	 * Perform the tracking.
+	 * @return      Tracking result.
+	 */
+	[[nodiscard]] Result::SharedPtr track() override {
+		if (mEventBuffer.size() < mNumberOfEvents) {
+			return nullptr;
+		}
+		if (mLastRunTimestamp == 0) {
+			mLastRunTimestamp = mEventBuffer.slice(mNumberOfEvents - 1, 1).getLowestTime() - mPeriod;
+		}
+		const int64_t nextRunTimestamp = mLastRunTimestamp + mPeriod;
+		if (nextRunTimestamp > mEventBuffer.getHighestTime()) {
+			return nullptr;
+		}
+
+		const dv::EventStore slice
+			= mEventBuffer.sliceTime(mEventBuffer.getLowestTime(), nextRunTimestamp + 1).sliceBack(mNumberOfEvents);
+		mLastRunTimestamp = nextRunTimestamp;
+
+		std::swap(mPreviousBuckets, mCurrentBuckets);
+		mCurrentBuckets.build(slice, mCellSize, mGridSize);
+
+		// Initialize if we do not have any features
+		if (!lastFrameResults || lastFrameResults->keypoints.empty()) {
+			const auto pyramid  = accumulateDetectionFrame(slice);
+			auto result         = acquireResult(nextRunTimestamp, true);
+			const auto detected = mDetector->runDetection(pyramid, maxTracks);
+			// Copy into the pooled buffer instead of move-assigning to keep its reserved capacity
+			result->keypoints.assign(detected);
+			return result;
+		}
+
+		mPoints.clear();
+		for (const auto &keypoint : lastFrameResults->keypoints) {
+			mPoints.emplace_back(keypoint.pt.x(), keypoint.pt.y());
+		}
+
+		trackPatches(mPoints, mTrackStatus, mTrackErrors);
+
+		// Fill in the keypoints
+		auto result = acquireResult(nextRunTimestamp, false);
+		for (size_t i = 0; i < mPoints.size(); i++) {
+			const auto &kpt = mPoints[i];
+
+			if (mTrackStatus[i] == 1 && mDetector->isWithinROI(kpt)) {
+				const auto &feat = lastFrameResults->keypoints[i];
+				result->keypoints.emplace_back(dv::Point2f(kpt.x, kpt.y), feat.size, feat.angle, mTrackErrors[i],
+					feat.octave, feat.class_id, nextRunTimestamp);
+			}
+		}
+
+		// Decide on redetection of features, this is the only case when a full frame is accumulated
+		if (mRedetectionStrategy->decideRedetection(*this)) {
+			const auto pyramid = accumulateDetectionFrame(slice);
+			cv::Mat mask;
+			if (mConfig.maskedFeatureDetect) {
+				// Disable search on locations where we already have features
+				mDetectionMask.create(mResolution, CV_8UC1);
+				mDetectionMask.setTo(cv::Scalar(255));
+				for (const auto &feat : result->keypoints) {
+					cv::circle(mDetectionMask, cv::Point2f(feat.pt.x(), feat.pt.y()),
+						static_cast<int>(std::ceil(feat.size / 2.f)), cv::Scalar(0), -1);
+				}
+				mask = mDetectionMask;
+			}
+			mDetector->runRedetection(result->keypoints, pyramid, maxTracks, mask);
+			result->asKeyFrame = true;
+		}
+
+		return result;
+	}
+
+	/**
+	 * Construct a patch based tracker.
+	 * @param resolution        Sensor resolution.
+	 * @param config            Lucas-Kanade tracker parameters.
+	 */
+	EventPatchLKTracker(const cv::Size &resolution, const Config &config) :
+		mConfig(config),
+		mResolution(resolution),
+		mNumberOfEvents(static_cast<size_t>(resolution.area() / 3)) {
+		setDetector(nullptr);
+		setRedetectionStrategy(nullptr);
+		setCellSize(mCellSize);
+	}
+
+public:
+	/**
+	 * Create a tracker instance that performs tracking of features on local event patches. Features are detected
+	 * on event accumulated frames.
+	 * @param resolution 		Sensor resolution
+	 * @param config 			Lucas-Kanade tracker configuration, `parallelBatchSize` is ignored, the patches
+	 * 							are always tracked in parallel.
+	 * @param detector 			Feature (corner) detector to be used.
+	 * 							Uses `cv::GFTTDetector` with default parameters by default.
+	 * @param redetection 		Feature redetection strategy.
+	 * 							By default, redetects features when feature count is bellow 0.5 of maximum value.
+	 * @return					The tracker instance
+	 */
+	[[nodiscard]] static EventPatchLKTracker::UniquePtr RegularTracker(const cv::Size &resolution,
+		const Config &config = Config(), ImagePyrFeatureDetector::UniquePtr detector = nullptr,
+		RedetectionStrategy::UniquePtr redetection = nullptr) {
+		EventPatchLKTracker::UniquePtr tracker{new EventPatchLKTracker(resolution, config)};
+		if (detector) {
+			tracker->setDetector(std::move(detector));
+		}
+		if (redetection) {
+			tracker->setRedetectionStrategy(std::move(redetection));
+		}
+		return tracker;
+	}
+
+	/**
+	 * Add the input events.
+	 * Since the batch of events might contain information for more than a single tracking iteration
+	 * configurable by the framerate parameter, the tracking function should be executed on a loop
+	 * until it returns a null-pointer, signifying end of available data processing.
+	 * @param store         Event batch.
+	 */
+	void accept(const dv::EventStore &store) {
+		mEventBuffer.add(store);
+		// Limit stored event count
+		if (mEventBuffer.duration() > mStoreTimeLimit) {
+			auto sliced = mEventBuffer.sliceTime(
+				mEventBuffer.getHighestTime() - mStoreTimeLimit.count(), mEventBuffer.getHighestTime() + 1);
+			if (sliced.size() >= mNumberOfEvents) {
+				mEventBuffer = sliced;
+			}
+		}
+	}
+
+	/**
+	 * Set a new redetection strategy.
+	 * @param redetectionStrategy 		Redetection strategy instance.
+	 */
+	void setRedetectionStrategy(RedetectionStrategy::UniquePtr redetectionStrategy) {
+		if (redetectionStrategy) {
+			mRedetectionStrategy = std::move(redetectionStrategy);
+		}
+		else {
+			mRedetectionStrategy = std::make_unique<FeatureCountRedetection>(0.5f);
+		}
+	}
+
+	/**
+	 * Set a new feature (corner) detector. If a `nullptr` is passed, the
+	 * function will instantiate a feature detector with no parameters (defaults).
+	 * @param detector 				Feature detector instance.
+	 */
+	void setDetector(ImagePyrFeatureDetector::UniquePtr detector) {
+		if (detector) {
+			mDetector = std::move(detector);
+		}
+		else {
+			mDetector = std::make_unique<dv::features::FeatureDetector<dv::features::ImagePyramid, cv::Feature2D>>(
+				mResolution, cv::GFTTDetector::create());
+		}
+	}
+
+	/**
+	 * Get the frame accumulated at the latest feature (re)detection. Frames are not accumulated for plain
+	 * tracking steps.
+	 * @return      An accumulated frame.
+	 */
+	[[nodiscard]] const cv::Mat &getAccumulatedFrame() const {
+		return mAccumulatedFrame;
+	}
+
+	/**
+	 * Get configured framerate.
+	 * @return      Current tracking framerate.
+	 */
+	[[nodiscard]] int getFramerate() const {
+		return mFramerate;
+	}
+
+	/**
+	 * Set the tracking framerate.
+	 * @param framerate        New tracking framerate.
+	 */
+	void setFramerate(const int framerate) {
+		mFramerate = framerate;
+		mPeriod    = 1000000 / framerate;
+	}
+
+	/**
+	 * Get the event storage time limit.
+	 * @return      Duration of the event storage in microseconds.
+	 */
+	[[nodiscard]] dv::Duration getStoreTimeLimit() const {
+		return mStoreTimeLimit;
+	}
+
+	/**
+	 * Set the event buffer storage duration limit.
+	 * @param storeTimeLimit       Storage duration limit in microseconds.
+	 */
+	void setStoreTimeLimit(const dv::Duration storeTimeLimit) {
+		mStoreTimeLimit = storeTimeLimit;
+	}
+
+	/**
+	 * Get the number of latest events that are used for each tracking step.
+	 * @return      Number of events.
+	 */
+	[[nodiscard]] size_t getNumberOfEvents() const {
+		return mNumberOfEvents;
+	}
+
+	/**
+	 * Set the number of latest events that are used for each tracking step.
+	 * The default number of event is a third of of total pixels in the sensor.
+	 * @param numberOfEvents    	Number of events.
+	 */
+	void setNumberOfEvents(const size_t numberOfEvents) {
+		mNumberOfEvents = numberOfEvents;
+	}
+
+	/**
+	 * Get the contribution of a single event to a patch pixel value.
+	 * @return      Event contribution coefficient.
+	 */
+	[[nodiscard]] float getEventContribution() const {
+		return mEventContribution;
+	}
+
+	/**
+	 * Set the contribution of a single event to a patch pixel value, same as
+	 * `dv::EdgeMapAccumulator::setEventContribution`.
+	 * @param contribution      Event contribution coefficient in the range [0.0; 1.0].
+	 */
+	void setEventContribution(const float contribution) {
+		if (contribution < 0.f || contribution > 1.f) {
+			throw dv::exceptions::InvalidArgument<float>(
+				"Contribution value should be in the range [0.0; 1.0]", contribution);
+		}
+		mEventContribution = contribution;
+		mDrawIncrement     = static_cast<uint8_t>(std::ceil(255.f * contribution));
+	}
+
+	/**
+	 * Get the patch radius.
+	 * @return      Patch radius in pixels.
+	 */
+	[[nodiscard]] int getPatchRadius() const {
+		return mPatchRadius;
+	}
+
+	/**
+	 * Set the radius of the square patch rendered around each keypoint. The patch has to contain the LK search
+	 * window and the expected feature motion within a single tracking step, tracks moving out of the patch are lost.
+	 * @param patchRadius       Patch radius in pixels, patch side is `2 * patchRadius + 1`.
+	 */
+	void setPatchRadius(const int patchRadius) {
+		if (patchRadius <= 0) {
+			throw dv::exceptions::InvalidArgument<int>("Patch radius must be positive", patchRadius);
+		}
+		mPatchRadius = patchRadius;
+	}
+
+	/**
+	 * Get the bucketing grid cell size.
+	 * @return      Cell size in pixels.
+	 */
+	[[nodiscard]] int getCellSize() const {
+		return mCellSize;
+	}
+
+	/**
+	 * Set the size of spatial grid cells events are bucketed into.
+	 * @param cellSize          Cell side in pixels.
+	 */
+	void setCellSize(const int cellSize) {
+		if (cellSize <= 0) {
+			throw dv::exceptions::InvalidArgument<int>("Cell size must be positive", cellSize);
+		}
+		mCellSize = cellSize;
+		mGridSize = cv::Size((mResolution.width + cellSize - 1) / cellSize,
+			(mResolution.height + cellSize - 1) / cellSize);
+
+		// Bucketed events are no longer valid for the new grid
+		mPreviousBuckets = EventBuckets();
+		mCurrentBuckets  = EventBuckets();
+	}
+};
+
+static_assert(concepts::Accepts<EventPatchLKTracker, dv::EventStore>);
+
+} // namespace dv::features
@@ -11,6 +11,8 @@
 #include <opencv2/core.hpp>
 #include <opencv2/features2d.hpp>
 
+#include <algorithm>
+
 namespace dv::features {
 template<class InputType, dv::concepts::FeatureDetectorAlgorithm<InputType> Algorithm>
 class FeatureDetector;
@@ -104,7 +106,7 @@ public:
 	 */
 	[[nodiscard]] dv::cvector<dv::TimedKeyPoint> runDetection(
 		const InputType &input, size_t numPoints, const cv::Mat &mask = cv::Mat()) {
-		dv::cvector<dv::TimedKeyPoint> result = detect(input, roiBuffered, mask);
+		dv::cvector<dv::TimedKeyPoint> result = detect(input, roiBuffered, mask, numPoints);
 
 		if (postProcessing == FeaturePostProcessing::AdaptiveNMS || postProcessing == FeaturePostProcessing::TopN) {
 			std::sort(result.begin(), result.end(), [](const dv::TimedKeyPoint &a, const dv::TimedKeyPoint &b) {
@@ -136,7 +138,12 @@ public:
 	 */
 	void runRedetection(dv::cvector<dv::TimedKeyPoint> &prior, const InputType &input, size_t numPoints,
 		const cv::Mat &mask = cv::Mat()) {
-		dv::cvector<dv::TimedKeyPoint> result = detect(input, roiBuffered, mask);
+		if (prior.size() >= numPoints) {
+			return;
+		}
+		const size_t missingPoints = numPoints - prior.size();
+
+		dv::cvector<dv::TimedKeyPoint> result = detect(input, roiBuffered, mask, missingPoints);
 
 		if (result.empty()) {
 			return;
@@ -151,12 +158,12 @@ public:
 		switch (postProcessing) {
 			case FeaturePostProcessing::None:
 			case FeaturePostProcessing::TopN:
-				if (result.size() > numPoints) {
-					result.resize(numPoints);
+				if (result.size() > missingPoints) {
+					result.resize(missingPoints);
 				}
 				break;
 			case FeaturePostProcessing::AdaptiveNMS:
-				result = resampler.resample(result, numPoints - prior.size());
+				result = resampler.resample(result, missingPoints);
 			default:
 				break;
 		}
@@ -207,6 +214,35 @@ public:
 		roiBuffered = getMarginROI();
 	}
 
+	/**
+	 * Get the grid of detection tiles.
+	 * @sa setTileGrid
+	 * @return              Number of tile columns and rows.
+	 */
+	[[nodiscard]] const cv::Size &getTileGrid() const {
+		return tileGrid;
+	}
+
+	/**
+	 * Set the grid of detection tiles. The region of interest is split into equally sized tiles which are
+	 * processed in parallel, each tile contributes at most an equal share of the requested number of keypoints
+	 * and the share unused by sparse tiles is filled with the strongest remaining keypoints. Besides reducing the
+	 * detection latency, the per-tile budgets distribute the keypoints evenly over the image. Tiles fully
+	 * excluded by the detection mask are skipped, which makes redetection cheaper.
+	 *
+	 * Tiling applies to OpenCV detection algorithms only, the algorithm instance is called concurrently, so it
+	 * has to be safe to do so (e.g. GFTT, FAST or AGAST detectors). Custom algorithms always process the whole
+	 * region of interest.
+	 * @param grid          Number of tile columns and rows, grid of 1x1 disables tiling.
+	 */
+	void setTileGrid(const cv::Size &grid) {
+		if (grid.width < 1 || grid.height < 1) {
+			throw std::invalid_argument("Provided tile grid (" + std::to_string(grid.width) + "x"
+										+ std::to_string(grid.height) + ") must have at least one tile");
+		}
+		tileGrid = grid;
+	}
+
 	/**
 	 * Check whether a point belongs to the ROI without the margins.
 	 * @param point         Point to be checked
@@ -244,6 +280,125 @@ private:
 	int classIdCounter = 0;
 	KeyPointResampler resampler;
 
+	/**
+	 * Number of tile columns and rows for tile-parallel detection.
+	 */
+	cv::Size tileGrid = cv::Size(1, 1);
+
+	/**
+	 * Detection buffers of each tile, reused across detection calls.
+	 */
+	std::vector<std::vector<cv::KeyPoint>> tileFeatures;
+
+	/**
+	 * Tiles are detected with this many pixels of surrounding image, so the detector response near tile borders
+	 * is not affected by the tiling.
+	 */
+	static constexpr int TileOverlap = 8;
+
+	/**
+	 * Get the image used by OpenCV detection algorithms from the input.
+	 */
+	[[nodiscard]] static const cv::Mat &getDetectionImage(const InputType &input) {
+		if constexpr (std::is_same_v<InputType, dv::features::ImagePyramid>) {
+			return input.pyramid.front();
+		}
+		else if constexpr (std::is_same_v<InputType, dv::Frame>) {
+			return input.image;
+		}
+		else if constexpr (dv::concepts::TimedImageContainer<InputType>) {
+			return input.image;
+		}
+		else {
+			static_assert(std::is_same_v<InputType, dv::features::ImagePyramid> || std::is_same_v<InputType, dv::Frame>
+							  || dv::concepts::TimedImageContainer<InputType>,
+				"InputType is not supported with OpenCV feature detectors, should be dv::features::ImagePyramid "
+				"or dv::Frame, or cv::mat, or satisfy dv::concepts::TimedImageContainer");
+		}
+	}
+
+	/**
+	 * Get a detection tile of the region of interest.
+	 * @param roi       Region of interest.
+	 * @param index     Row-major index of the tile.
+	 * @return          Tile region.
+	 */
+	[[nodiscard]] cv::Rect getTile(const cv::Rect &roi, const int index) const {
+		const int column = index % tileGrid.width;
+		const int row    = index / tileGrid.width;
+		const int left   = roi.x + (roi.width * column) / tileGrid.width;
+		const int top    = roi.y + (roi.height * row) / tileGrid.height;
+		const int right  = roi.x + (roi.width * (column + 1)) / tileGrid.width;
+		const int bottom = roi.y + (roi.height * (row + 1)) / tileGrid.height;
+		return {left, top, right - left, bottom - top};
+	}
+
+	/**
+	 * Run an OpenCV detection algorithm on the tiles of the region of interest in parallel, keeping at most
+	 * an equal share of the requested number of keypoints per tile and filling the share unused by sparse tiles
+	 * with the strongest remaining keypoints.
+	 * @param image     Input image.
+	 * @param roi       Region of interest.
+	 * @param mask      Detection mask, can be empty.
+	 * @param numPoints Number of requested keypoints.
+	 * @return          Keypoints in image coordinates, ordered by tile.
+	 */
+	[[nodiscard]] std::vector<cv::KeyPoint> detectTiles(
+		const cv::Mat &image, const cv::Rect &roi, const cv::Mat &mask, const size_t numPoints) {
+		const int numTiles  = tileGrid.area();
+		const size_t budget = (numPoints + static_cast<size_t>(numTiles) - 1) / static_cast<size_t>(numTiles);
+		const auto byResponse = [](const cv::KeyPoint &a, const cv::KeyPoint &b) {
+			return a.response > b.response;
+		};
+
+		tileFeatures.resize(static_cast<size_t>(numTiles));
+		cv::parallel_for_(cv::Range(0, numTiles), [&](const cv::Range &range) {
+			for (int index = range.start; index < range.end; index++) {
+				auto &features = tileFeatures[static_cast<size_t>(index)];
+				features.clear();
+
+				const cv::Rect tile = getTile(roi, index);
+				if (tile.empty() || (!mask.empty() && cv::countNonZero(mask(tile)) == 0)) {
+					continue;
+				}
+
+				const cv::Rect window = cv::Rect(tile.x - TileOverlap, tile.y - TileOverlap,
+											tile.width + (2 * TileOverlap), tile.height + (2 * TileOverlap))
+									  & roi;
+				detector->detect(image(window), features, mask.empty() ? mask : mask(window));
+
+				// Keep only the features within the tile, the overlap belongs to neighbouring tiles
+				for (auto &feature : features) {
+					feature.pt.x += static_cast<float>(window.x);
+					feature.pt.y += static_cast<float>(window.y);
+				}
+				std::erase_if(features, [&tile](const cv::KeyPoint &feature) {
+					return feature.pt.x < static_cast<float>(tile.x) || feature.pt.y < static_cast<float>(tile.y)
+						|| feature.pt.x >= static_cast<float>(tile.x + tile.width)
+						|| feature.pt.y >= static_cast<float>(tile.y + tile.height);
+				});
+				std::sort(features.begin(), features.end(), byResponse);
+			}
+		});
+
+		std::vector<cv::KeyPoint> selected;
+		std::vector<cv::KeyPoint> surplus;
+		selected.reserve(numPoints);
+		for (const auto &features : tileFeatures) {
+			const auto split = features.begin() + static_cast<std::ptrdiff_t>(std::min(budget, features.size()));
+			selected.insert(selected.end(), features.begin(), split);
+			surplus.insert(surplus.end(), split, features.end());
+		}
+
+		if (selected.size() < numPoints && !surplus.empty()) {
+			const auto fill = static_cast<std::ptrdiff_t>(std::min(numPoints - selected.size(), surplus.size()));
+			std::partial_sort(surplus.begin(), surplus.begin() + fill, surplus.end(), byResponse);
+			selected.insert(selected.end(), surplus.begin(), surplus.begin() + fill);
+		}
+
+		return selected;
+	}
+
 	/**
 	 * The detection function to be implemented for feature detection. It should return a list
 	 * of keypoints with a quality score, but it should *not* be ordered in any way. The sorting
@@ -253,33 +408,31 @@ private:
 	 *                  using the margin configuration value.
 	 * @param mask      Detection mask, can be empty. If non empty, the detection should be performed
 	 *                  where mask value is non-zero.
+	 * @param numPoints Number of requested keypoints, limits the keypoints kept per tile in tiled detection.
 	 * @return          A list of keypoint features with timestamp.
 	 */
 	[[nodiscard]] dv::cvector<dv::TimedKeyPoint> detect(
-		const InputType &input, const cv::Rect &roi, const cv::Mat &mask) {
+		const InputType &input, const cv::Rect &roi, const cv::Mat &mask, const size_t numPoints) {
 		dv::cvector<dv::TimedKeyPoint> output;
 
 		if constexpr (concepts::OpenCVFeatureDetectorAlgorithm<Algorithm>) {
-			std::vector<cv::KeyPoint> cvFeatures;
+			const cv::Mat &image = getDetectionImage(input);
 
-			if constexpr (std::is_same_v<InputType, dv::features::ImagePyramid>) {
-				detector->detect(input.pyramid.front()(roi), cvFeatures, mask.empty() ? mask : mask(roi));
-			}
-			else if constexpr (std::is_same_v<InputType, dv::Frame>) {
-				detector->detect(input.image(roi), cvFeatures, mask.empty() ? mask : mask(roi));
-			}
-			else if constexpr (dv::concepts::TimedImageContainer<InputType>) {
-				detector->detect(input.image(roi), cvFeatures, mask.empty() ? mask : mask(roi));
+			if (tileGrid.area() > 1) {
+				output = dv::data::fromCvKeypoints(detectTiles(image, roi, mask, numPoints), input.timestamp);
 			}
 			else {
-				static_assert(std::is_same_v<InputType, dv::features::ImagePyramid>
-								  || std::is_same_v<InputType, dv::Frame> || std::is_same_v<InputType, dv::Frame>
-								  || dv::concepts::TimedImageContainer<InputType>,
-					"InputType is not supported with OpenCV feature detectors, should be dv::features::ImagePyramid "
-					"or dv::Frame, or cv::mat, or satisfy dv::concepts::TimedImageContainer");
-			}
+				std::vector<cv::KeyPoint> cvFeatures;
+				detector->detect(image(roi), cvFeatures, mask.empty() ? mask : mask(roi));
+				output = dv::data::fromCvKeypoints(cvFeatures, input.timestamp);
 
-			output = dv::data::fromCvKeypoints(cvFeatures, input.timestamp);
+				// Coordinates within cv::Mat that represents an ROI are offset by the ROI top-left coordinates, so we
+				// need to correct them
+				for (auto &corner : output) {
+					corner.pt = dv::Point2f(
+						corner.pt.x() + static_cast<float>(roi.x), corner.pt.y() + static_cast<float>(roi.y));
+				}
+			}
 		}
 		else {
 			output = detector->detect(input, roi, mask.empty() ? mask : mask(roi));
@@ -289,11 +442,6 @@ private:
 			corner.class_id = classIdCounter++;
 
 			if constexpr (concepts::OpenCVFeatureDetectorAlgorithm<Algorithm>) {
-				// Coordinates within cv::Mat that represents an ROI are offset by the ROI top-left coordinates, so we
-				// need to correct them
-				corner.pt = dv::Point2f(corner.pt.x() + static_cast<float>(roiBuffered.x),
-					corner.pt.y() + static_cast<float>(roiBuffered.y));
-
 				// OpenCV feature detection algorithms don't provide a timestamp, so we need to add them
 				corner.timestamp = input.timestamp;
 			}
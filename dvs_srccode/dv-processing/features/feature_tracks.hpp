@@ -5,15 +5,92 @@
 #include "../visualization/colors.hpp"
 #include "tracker_base.hpp"
 
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <vector>
+
 namespace dv::features {
 
 /**
  * A class to store a time limited amount of feature tracks. Sorts and stores the data in separate queues for
  * each track id. Provides `visualize` function to generate visualization images of the tracks.
+ *
+ * Each track is stored in a contiguous ring buffer, buffers of removed tracks are reused for new tracks. Track ids
+ * are mapped to the buffers by a sorted flat map. Expired measurements are removed only when the highest received
+ * timestamp indicates that some measurement can be out of the limits, so accepting keypoints does not traverse all
+ * tracks on each call.
  */
 class FeatureTracks {
 private:
-	std::map<int32_t, std::shared_ptr<std::deque<dv::TimedKeyPoint>>> mHistory;
+	/**
+	 * Keypoint history of a single track in a ring buffer that grows by doubling its capacity.
+	 */
+	struct TrackBuffer {
+		std::vector<dv::TimedKeyPoint> keypoints;
+		size_t head = 0;
+		size_t size = 0;
+
+		[[nodiscard]] const dv::TimedKeyPoint &at(const size_t index) const {
+			const size_t position = head + index;
+			return keypoints[position < keypoints.size() ? position : position - keypoints.size()];
+		}
+
+		[[nodiscard]] const dv::TimedKeyPoint &front() const {
+			return keypoints[head];
+		}
+
+		[[nodiscard]] const dv::TimedKeyPoint &back() const {
+			return at(size - 1);
+		}
+
+		void push(const dv::TimedKeyPoint &keypoint) {
+			if (size == keypoints.size()) {
+				std::vector<dv::TimedKeyPoint> grown(std::max<size_t>(8, 2 * size));
+				for (size_t i = 0; i < size; i++) {
+					grown[i] = at(i);
+				}
+				keypoints = std::move(grown);
+				head      = 0;
+			}
+			const size_t position = head + size;
+			keypoints[position < keypoints.size() ? position : position - keypoints.size()] = keypoint;
+			size++;
+		}
+
+		void popFront() {
+			head = (head + 1 == keypoints.size()) ? 0 : head + 1;
+			size--;
+		}
+
+		void reset() {
+			head = 0;
+			size = 0;
+		}
+	};
+
+	/**
+	 * Track buffer slots, including unused slots of removed tracks.
+	 */
+	std::vector<TrackBuffer> mTracks;
+
+	/**
+	 * Slots of removed tracks available for reuse.
+	 */
+	std::vector<uint32_t> mFreeSlots;
+
+	/**
+	 * Sorted ids of stored tracks and the corresponding slots.
+	 */
+	std::vector<int32_t> mTrackIds;
+	std::vector<uint32_t> mTrackSlots;
+
+	/**
+	 * Lower bounds of the earliest timestamp and of the latest timestamp among all tracks, used to skip buffer
+	 * maintenance while no measurement can be out of limits.
+	 */
+	int64_t mEarliestTimestamp = std::numeric_limits<int64_t>::max();
+	int64_t mEarliestLatestTimestamp = std::numeric_limits<int64_t>::max();
 
 	dv::Duration mHistoryDuration = dv::Duration(500'000);
 
@@ -26,11 +103,29 @@ private:
 	 * @param keypoint 		Keypoint measurement
 	 */
 	void addKeypoint(const dv::TimedKeyPoint &keypoint) {
-		if (!mHistory.contains(keypoint.class_id)) {
-			mHistory.emplace(keypoint.class_id, std::make_shared<std::deque<dv::TimedKeyPoint>>());
+		const auto iter     = std::lower_bound(mTrackIds.begin(), mTrackIds.end(), keypoint.class_id);
+		const auto position = iter - mTrackIds.begin();
+
+		uint32_t slot;
+		if (iter != mTrackIds.end() && *iter == keypoint.class_id) {
+			slot = mTrackSlots[static_cast<size_t>(position)];
 		}
-		auto &history = mHistory[keypoint.class_id];
-		history->push_back(keypoint);
+		else {
+			if (mFreeSlots.empty()) {
+				slot = static_cast<uint32_t>(mTracks.size());
+				mTracks.emplace_back();
+			}
+			else {
+				slot = mFreeSlots.back();
+				mFreeSlots.pop_back();
+			}
+			mTrackIds.insert(iter, keypoint.class_id);
+			mTrackSlots.insert(mTrackSlots.begin() + position, slot);
+			mEarliestTimestamp = std::min(mEarliestTimestamp, keypoint.timestamp);
+		}
+
+		mTracks[slot].push(keypoint);
+		mEarliestLatestTimestamp = std::min(mEarliestLatestTimestamp, keypoint.timestamp);
 
 		if (keypoint.timestamp > mHighestTime) {
 			mHighestTime = keypoint.timestamp;
@@ -38,28 +133,117 @@ private:
 	}
 
 	/**
-	 * Check the whole buffer for out-of-limit data, remove any tracks that do not contain any measurements.
+	 * Add a batch of keypoint measurements, buffer limits are maintained once for the whole batch.
+	 * @param keypoints 	Keypoint measurements
+	 */
+	void addKeypoints(const dv::cvector<dv::TimedKeyPoint> &keypoints) {
+		for (const auto &keypoint : keypoints) {
+			addKeypoint(keypoint);
+		}
+		maintainBufferDuration();
+	}
+
+	/**
+	 * Remove out-of-limit data, remove any tracks that do not contain any measurements. The buffer is traversed
+	 * only if some measurement can be out of limits.
+	 * @param force 	Traverse the buffer regardless of the timestamp bounds.
 	 */
-	void maintainBufferDuration() {
-		if (mTrackTimeout.has_value()) {
-			std::erase_if(mHistory, [this](const auto &track) {
-				return !track.second->empty()
-					&& dv::Duration(mHighestTime - track.second->back().timestamp) > mTrackTimeout;
-			});
+	void maintainBufferDuration(const bool force = false) {
+		const bool historyExceeded = dv::Duration(mHighestTime - mEarliestTimestamp) > mHistoryDuration;
+		const bool timeoutExceeded
+			= mTrackTimeout.has_value() && dv::Duration(mHighestTime - mEarliestLatestTimestamp) > *mTrackTimeout;
+		if (!force && !historyExceeded && !timeoutExceeded) {
+			return;
 		}
 
-		// Maintain history duration
-		for (auto &[_, track] : mHistory) {
-			while (!track->empty() && dv::Duration(mHighestTime - track->front().timestamp) > mHistoryDuration) {
-				track->pop_front();
+		mEarliestTimestamp       = std::numeric_limits<int64_t>::max();
+		mEarliestLatestTimestamp = std::numeric_limits<int64_t>::max();
+
+		size_t retained = 0;
+		for (size_t i = 0; i < mTrackIds.size(); i++) {
+			const uint32_t slot = mTrackSlots[i];
+			auto &track         = mTracks[slot];
+
+			bool remove = mTrackTimeout.has_value() && track.size > 0
+					   && dv::Duration(mHighestTime - track.back().timestamp) > *mTrackTimeout;
+
+			// Maintain history duration
+			while (!remove && track.size > 0
+				   && dv::Duration(mHighestTime - track.front().timestamp) > mHistoryDuration) {
+				track.popFront();
 			}
+
+			if (remove || track.size == 0) {
+				track.reset();
+				mFreeSlots.push_back(slot);
+				continue;
+			}
+
+			mEarliestTimestamp       = std::min(mEarliestTimestamp, track.front().timestamp);
+			mEarliestLatestTimestamp = std::min(mEarliestLatestTimestamp, track.back().timestamp);
+			mTrackIds[retained]      = mTrackIds[i];
+			mTrackSlots[retained]    = slot;
+			retained++;
 		}
-		std::erase_if(mHistory, [](const auto &track) {
-			return track.second->empty();
-		});
+		mTrackIds.resize(retained);
+		mTrackSlots.resize(retained);
 	}
 
 public:
+	/**
+	 * Non-owning read-only view of a single track history, ordered from the oldest to the latest measurement.
+	 * The view is invalidated by any modification of the feature tracks.
+	 */
+	class TrackView {
+	public:
+		explicit TrackView(const TrackBuffer &track) : mTrack(&track) {
+		}
+
+		/**
+		 * Number of measurements in the track.
+		 * @return 		Track length.
+		 */
+		[[nodiscard]] size_t size() const {
+			return mTrack->size;
+		}
+
+		/**
+		 * Check whether the track contains no measurements.
+		 * @return 		True if the track is empty.
+		 */
+		[[nodiscard]] bool empty() const {
+			return mTrack->size == 0;
+		}
+
+		/**
+		 * Access a measurement of the track, index 0 refers to the oldest measurement.
+		 * @param index 	Measurement index.
+		 * @return 			Keypoint measurement.
+		 */
+		[[nodiscard]] const dv::TimedKeyPoint &operator[](const size_t index) const {
+			return mTrack->at(index);
+		}
+
+		/**
+		 * Oldest measurement of the track.
+		 * @return 		Keypoint measurement.
+		 */
+		[[nodiscard]] const dv::TimedKeyPoint &front() const {
+			return mTrack->front();
+		}
+
+		/**
+		 * Latest measurement of the track.
+		 * @return 		Keypoint measurement.
+		 */
+		[[nodiscard]] const dv::TimedKeyPoint &back() const {
+			return mTrack->back();
+		}
+
+	private:
+		const TrackBuffer *mTrack;
+	};
+
 	/**
 	 * Add a keypoint measurement into the feature track.
 	 * @param keypoint 		Single keypoint measurement.
@@ -74,10 +258,7 @@ public:
 	 * @param keypoints 		Vector of keypoint measurements.
 	 */
 	void accept(const dv::TimedKeyPointPacket &keypoints) {
-		for (const auto &keypoint : keypoints.elements) {
-			addKeypoint(keypoint);
-		}
-		maintainBufferDuration();
+		addKeypoints(keypoints.elements);
 	}
 
 	/**
@@ -94,10 +275,7 @@ public:
 	 * @param trackingResult 	Tracking results.
 	 */
 	void accept(const TrackerBase::Result::ConstPtr &trackingResult) {
-		for (const auto &kp : trackingResult->keypoints) {
-			addKeypoint(kp);
-		}
-		maintainBufferDuration();
+		addKeypoints(trackingResult->keypoints);
 	}
 
 	/**
@@ -120,33 +298,42 @@ public:
 				"Track history duration for the FeatureTracks must be positive non-zero duration value.");
 		}
 		mHistoryDuration = historyDuration;
-		maintainBufferDuration();
+		maintainBufferDuration(true);
 	}
 
 	/**
-	 * Retrieve a track of given track id.
+	 * Retrieve a track of given track id. The track history is copied into the returned container, use
+	 * `getTrackView` to access the history without copying.
 	 * @param trackId 		Track id to retrieve.
 	 * @return 				A pointer to feature track history, `std::nullopt` if unavailable.
 	 */
 	[[nodiscard]] std::optional<std::shared_ptr<const std::deque<dv::TimedKeyPoint>>> getTrack(
 		const int32_t trackId) const {
-		if (mHistory.contains(trackId)) {
-			return std::static_pointer_cast<const std::deque<dv::TimedKeyPoint>>(mHistory.at(trackId));
+		if (const auto view = getTrackView(trackId); view.has_value()) {
+			return copyTrack(*view);
 		}
 		return std::nullopt;
 	}
 
+	/**
+	 * Retrieve a view of a track of given track id.
+	 * @param trackId 		Track id to retrieve.
+	 * @return 				A view of the feature track history, `std::nullopt` if unavailable.
+	 */
+	[[nodiscard]] std::optional<TrackView> getTrackView(const int32_t trackId) const {
+		const auto iter = std::lower_bound(mTrackIds.begin(), mTrackIds.end(), trackId);
+		if (iter == mTrackIds.end() || *iter != trackId) {
+			return std::nullopt;
+		}
+		return TrackView(mTracks[mTrackSlots[static_cast<size_t>(iter - mTrackIds.begin())]]);
+	}
+
 	/**
 	 * Return all track ids that are available in the buffer.
 	 * @return 		A vector containing track ids store in the history buffer.
 	 */
 	[[nodiscard]] std::vector<int32_t> getTrackIds() const {
-		std::vector<int32_t> keys;
-		keys.reserve(mHistory.size());
-		for (const auto &[id, _] : mHistory) {
-			keys.push_back(id);
-		}
-		return keys;
+		return mTrackIds;
 	}
 
 	/**
@@ -155,23 +342,37 @@ public:
 	 */
 	dv::TimedKeyPointPacket getLatestTrackKeypoints() {
 		dv::TimedKeyPointPacket lastKeypoints;
-		for (const auto &[_, track] : mHistory) {
-			lastKeypoints.elements.push_back(track->back());
+		lastKeypoints.elements.reserve(mTrackSlots.size());
+		for (const uint32_t slot : mTrackSlots) {
+			lastKeypoints.elements.push_back(mTracks[slot].back());
 		}
 
 		return lastKeypoints;
 	}
 
 	/**
-	 * Run a callback function to each of the stored tracks.
+	 * Run a callback function to each of the stored tracks. Track histories are copied for the callback, use
+	 * `eachTrackView` to access the histories without copying.
 	 * @param callback 		Callback function that is going to be called for each of the tracks, tracks are
 	 * 						passed into the callback function as arguments.
 	 */
 	void eachTrack(
 		const std::function<void(const int32_t, const std::shared_ptr<const std::deque<dv::TimedKeyPoint>> &)>
 			&callback) const {
-		for (const auto &[id, history] : mHistory) {
-			callback(id, std::static_pointer_cast<const std::deque<dv::TimedKeyPoint>>(history));
+		for (size_t i = 0; i < mTrackIds.size(); i++) {
+			callback(mTrackIds[i], copyTrack(TrackView(mTracks[mTrackSlots[i]])));
+		}
+	}
+
+	/**
+	 * Run a callback function to each of the stored tracks in increasing track id order, passing a view of the
+	 * track history.
+	 * @param callback 		Callable with `(const int32_t, const TrackView &)` arguments.
+	 */
+	template<class Callback>
+	void eachTrackView(Callback &&callback) const {
+		for (size_t i = 0; i < mTrackIds.size(); i++) {
+			callback(mTrackIds[i], TrackView(mTracks[mTrackSlots[i]]));
 		}
 	}
 
@@ -184,6 +385,23 @@ public:
 	 */
 	[[nodiscard]] cv::Mat visualize(const cv::Mat &background) const {
 		cv::Mat output;
+		visualize(background, output);
+		return output;
+	}
+
+	/**
+	 * Draws tracks on the input image into a caller-provided output image. Output image memory is reused if it
+	 * already has the size and type of the visualization.
+	 * @param background        Background image to be used for tracks.
+	 * @param output 			Output image with drawn colored feature tracks.
+	 * @throws InvalidArgument	An `InvalidArgument` exception is thrown if an empty image is passed as background.
+	 */
+	void visualize(const cv::Mat &background, cv::Mat &output) const {
+		if (background.empty()) {
+			throw dv::exceptions::InvalidArgument<void *>(
+				"Empty image was passed into the FeatureTracks for visualization.");
+		}
+
 		if (background.channels() != 3) {
 			cv::cvtColor(background, output, cv::COLOR_GRAY2BGR);
 		}
@@ -191,30 +409,21 @@ public:
 			background.copyTo(output);
 		}
 
-		if (output.empty()) {
-			throw dv::exceptions::InvalidArgument<void *>(
-				"Empty image was passed into the FeatureTracks for visualization.");
-		}
-
-		for (const auto &[id, history] : mHistory) {
-			auto iter        = history->crbegin();
-			const auto color = dv::visualization::colors::someNeonColor(id);
-			cv::Point2f prevPoint;
-			while (iter != history->crend()) {
-				if (iter == history->crbegin()) {
-					// Just draw the marker
-					prevPoint = cv::Point2f(iter->pt.x(), iter->pt.y());
-					cv::drawMarker(output, prevPoint, color, cv::MARKER_SQUARE, 5);
-					iter++;
-					continue;
-				}
-				cv::Point2f currPoint = cv::Point2f(iter->pt.x(), iter->pt.y());
+		for (size_t i = 0; i < mTrackIds.size(); i++) {
+			const auto &track = mTracks[mTrackSlots[i]];
+			const auto color  = dv::visualization::colors::someNeonColor(mTrackIds[i]);
+
+			// Draw the marker at the latest position and connect the measurements back in time
+			const auto &latest = track.back();
+			cv::Point2f prevPoint(latest.pt.x(), latest.pt.y());
+			cv::drawMarker(output, prevPoint, color, cv::MARKER_SQUARE, 5);
+			for (size_t index = track.size - 1; index > 0; index--) {
+				const auto &keypoint = track.at(index - 1);
+				const cv::Point2f currPoint(keypoint.pt.x(), keypoint.pt.y());
 				cv::line(output, prevPoint, currPoint, color, 1);
-				prevPoint = std::move(currPoint);
-				iter++;
+				prevPoint = currPoint;
 			}
 		}
-		return output;
 	}
 
 	/**
@@ -222,21 +431,22 @@ public:
 	 * @return 		True if there are no feature keypoints in the buffer.
 	 */
 	[[nodiscard]] bool isEmpty() const {
-		if (mHistory.empty()) {
-			return true;
-		}
-
-		return !std::any_of(mHistory.begin(), mHistory.end(), [](const auto &track) {
-			return !track.second->empty();
-		});
+		return mTrackIds.empty();
 	}
 
 	/**
 	 * Deletes any data stored in feature track buffer and resets visualization image.
 	 */
 	void clear() {
-		mHistory.clear();
-		mHighestTime = -1;
+		for (const uint32_t slot : mTrackSlots) {
+			mTracks[slot].reset();
+			mFreeSlots.push_back(slot);
+		}
+		mTrackIds.clear();
+		mTrackSlots.clear();
+		mEarliestTimestamp       = std::numeric_limits<int64_t>::max();
+		mEarliestLatestTimestamp = std::numeric_limits<int64_t>::max();
+		mHighestTime             = -1;
 	}
 
 	/**
@@ -261,6 +471,17 @@ public:
 		mTrackTimeout = trackTimeout;
 	}
 
+private:
+	[[nodiscard]] static std::shared_ptr<const std::deque<dv::TimedKeyPoint>> copyTrack(const TrackView &track) {
+		auto history = std::make_shared<std::deque<dv::TimedKeyPoint>>();
+		for (size_t i = 0; i < track.size(); i++) {
+			history->push_back(track[i]);
+		}
+		return history;
+	}
+
+public:
+
 	/**
 	 * Return latest time from all existing tracks.
 	 */
@@ -35,6 +35,14 @@ struct LucasKanadeConfig {
 	 * Size of the search around the tracked feature.
 	 */
 	cv::Size searchWindowSize = cv::Size(24, 24);
+
+	/**
+	 * Number of keypoints in a parallel tracking batch. If non-zero, keypoints are split into batches of this size
+	 * and the batches are tracked concurrently on the OpenCV worker threads, each batch performing its forward and
+	 * lookback passes independently, so forward and lookback passes of different batches overlap. The tracking
+	 * result is identical to the serial tracking. Zero disables batching and tracks all keypoints in a single call.
+	 */
+	size_t parallelBatchSize = 0;
 };
 
 /**
@@ -55,9 +63,11 @@ protected:
 
 	cv::Ptr<cv::SparsePyrLKOpticalFlow> mTracker;
 
-	ImagePyramid::UniquePtr mPreviousFrame = nullptr;
+	ImagePyramid::ConstPtr mPreviousFrame = nullptr;
 
-	ImagePyramid::UniquePtr mCurrentFrame = nullptr;
+	ImagePyramid::ConstPtr mCurrentFrame = nullptr;
+
+	ImagePyramidCache::SharedPtr mPyramidCache = nullptr;
 
 	kinematics::PixelMotionPredictor::UniquePtr mPredictor = nullptr;
 
@@ -78,13 +88,41 @@ protected:
 
 	float constantDepth = 3.f;
 
+	/**
+	 * Point and status buffers reused across tracking steps.
+	 */
+	std::vector<cv::Point2f> mPreviousPoints;
+	std::vector<cv::Point2f> mPredictedPoints;
+	std::vector<unsigned char> mTrackStatus;
+	std::vector<float> mTrackErrors;
+
+	/**
+	 * Redetection mask buffer reused across tracking steps.
+	 */
+	cv::Mat mDetectionMask;
+
 	[[nodiscard]] std::vector<cv::Point2f> predictNextPoints(
 		const int64_t previousTime, const std::vector<cv::Point2f> &previousPoints, const int64_t nextTime) {
+		std::vector<cv::Point2f> prediction;
+		predictNextPoints(previousTime, previousPoints, nextTime, prediction);
+		return prediction;
+	}
+
+	/**
+	 * Predict point locations at the next time into a reused output buffer.
+	 * @param previousTime      Time of the previous point locations.
+	 * @param previousPoints    Previous point locations.
+	 * @param nextTime          Time of the prediction.
+	 * @param prediction        Output predicted point locations.
+	 */
+	void predictNextPoints(const int64_t previousTime, const std::vector<cv::Point2f> &previousPoints,
+		const int64_t nextTime, std::vector<cv::Point2f> &prediction) {
 		// The class does not contain predictor or no transform can be a case when the external
 		// estimator is not initialized, so the MotionAware tracker will behave as a regular tracker. Return
 		// a copy of the previous point locations.
 		if (!mPredictor || !mTransformer) {
-			return previousPoints;
+			prediction = previousPoints;
+			return;
 		}
 
 		// Extract camera poses estimated externally
@@ -93,7 +131,8 @@ protected:
 
 		// Transforms are not yet available
 		if (!T_WC0 || !T_WC1) {
-			return previousPoints;
+			prediction = previousPoints;
+			return;
 		}
 
 		// 3 meter depth is a quite a reasonable guess for the estimator, a rough estimate also provide decent overall
@@ -108,7 +147,7 @@ protected:
 		// Delta transform from T_WC0 (prev) -> T_WC1 (next)
 		auto T_C0_C1 = T_WC0->delta(*T_WC1);
 		// Predict poses of the previous points
-		std::vector<cv::Point2f> prediction;
+		prediction.clear();
 		prediction.reserve(previousPoints.size());
 
 		for (const auto &p : previousPoints) {
@@ -120,91 +159,191 @@ protected:
 				prediction.push_back(p);
 			}
 		}
-		return prediction;
 	}
 
 	/**
-	 * Perform the LK tracking.
-	 * @return      Result of the tracking.
+	 * Copy the keypoint locations of the last tracking result into the previous point buffer.
 	 */
-	[[nodiscard]] Result::SharedPtr track() override {
-		dv::runtime_assert(static_cast<bool>(mCurrentFrame), "Current frame is not passed!");
-
-		// Initialize if we do not have any features
-		if (!mPreviousFrame || lastFrameResults->keypoints.empty()) {
-			TrackerBase::Result::SharedPtr result = std::make_shared<TrackerBase::Result>(
-				mCurrentFrame->timestamp, mDetector->runDetection(*mCurrentFrame, maxTracks), true);
-			mPreviousFrame = std::move(mCurrentFrame);
-			return result;
+	void loadPreviousPoints() {
+		mPreviousPoints.clear();
+		for (const auto &keypoint : lastFrameResults->keypoints) {
+			mPreviousPoints.emplace_back(keypoint.pt.x(), keypoint.pt.y());
 		}
+	}
 
-		// Perform LK tracking
-		std::vector<unsigned char> status;
-		std::vector<float> err;
+	/**
+	 * Add successfully tracked points into the result, keeping the attributes of the tracked keypoints.
+	 * @param result            Tracking result.
+	 */
+	void collectTrackedPoints(TrackerBase::Result &result) const {
+		for (size_t i = 0; i < mPredictedPoints.size(); i++) {
+			// Select good points
+			const auto &kpt = mPredictedPoints[i];
 
-		std::vector<cv::Point2f> previousKpts = dv::data::convertToCvPoints(lastFrameResults->keypoints);
-		std::vector<cv::Point2f> predictedKpts
-			= predictNextPoints(lastFrameResults->timestamp, previousKpts, mCurrentFrame->timestamp);
+			if (mTrackStatus[i] == 1 && mDetector->isWithinROI(kpt)) {
+				const auto &feat = lastFrameResults->keypoints[i];
+				result.keypoints.emplace_back(dv::Point2f(kpt.x, kpt.y), feat.size, feat.angle, mTrackErrors[i],
+					feat.octave, feat.class_id, result.timestamp);
+			}
+		}
+	}
 
-		// This should never be the case, but let's be careful
-		if (predictedKpts.empty()) {
-			predictedKpts = previousKpts;
+	/**
+	 * Prepare the redetection mask buffer, disabling detection around the given keypoints.
+	 * @param keypoints         Keypoints to be masked out.
+	 * @param radiusScale       Scale of keypoint size giving the masked radius.
+	 * @param lineType          Line type of the masked circles.
+	 * @return                  Mask buffer.
+	 */
+	[[nodiscard]] const cv::Mat &prepareDetectionMask(
+		const dv::cvector<dv::TimedKeyPoint> &keypoints, const float radiusScale, const int lineType = cv::LINE_8) {
+		mDetectionMask.create(mCurrentFrame->pyramid.at(0).size(), CV_8UC1);
+		mDetectionMask.setTo(cv::Scalar(255));
+		for (const auto &feat : keypoints) {
+			cv::circle(mDetectionMask, cv::Point2f(feat.pt.x(), feat.pt.y()),
+				static_cast<int>(std::ceil(feat.size * radiusScale)), cv::Scalar(0), -1, lineType);
 		}
+		return mDetectionMask;
+	}
 
-		mTracker->calc(mPreviousFrame->pyramid, mCurrentFrame->pyramid, previousKpts, predictedKpts, status, err);
+	/**
+	 * Track a contiguous batch of points forward from one pyramid into another and optionally validate the tracks
+	 * with lookback rejection.
+	 * @param tracker       Sparse LK tracker instance to perform the tracking with.
+	 * @param from          Pyramid to track from.
+	 * @param to            Pyramid to track into.
+	 * @param points        Point locations on the `from` pyramid.
+	 * @param tracked       Initial location guesses on input, tracked locations on output.
+	 * @param status        Output tracking status, 1 for successfully tracked points.
+	 * @param err           Output tracking error.
+	 * @param lookback      Perform lookback rejection on the tracked points.
+	 */
+	void trackBatch(cv::SparsePyrLKOpticalFlow &tracker, const ImagePyramid &from, const ImagePyramid &to,
+		const std::vector<cv::Point2f> &points, std::vector<cv::Point2f> &tracked, std::vector<unsigned char> &status,
+		std::vector<float> &err, const bool lookback) const {
+		tracker.calc(from.pyramid, to.pyramid, points, tracked, status, err);
 
 		// Perform backward tracking and validate that tracking corresponds
-		if (mLookbackRejection) {
+		if (lookback) {
 			std::vector<unsigned char> lbStatus;
 			std::vector<float> lbErr;
 			// Performing this without actual prediction value
-			std::vector<cv::Point2f> lbKpts = predictedKpts;
+			std::vector<cv::Point2f> lbKpts = tracked;
 
-			mTracker->calc(mCurrentFrame->pyramid, mPreviousFrame->pyramid, predictedKpts, lbKpts, lbStatus, lbErr);
+			tracker.calc(to.pyramid, from.pyramid, tracked, lbKpts, lbStatus, lbErr);
 			for (size_t i = 0; i < lbKpts.size(); i++) {
 				// Select good points
 				const auto &kpt = lbKpts[i];
 				// If look-back tracking failed or tracked distance does not correspond with 5 pixel radius -- reject
-				if (lbStatus[i] != 1 || cv::norm((kpt - predictedKpts[i])) > mRejectionDistanceThreshold) {
+				if (lbStatus[i] != 1 || cv::norm((kpt - tracked[i])) > mRejectionDistanceThreshold) {
 					status[i] = 0;
 				}
 			}
 		}
+	}
 
-		// Fill in the keypoints
-		dv::cvector<dv::TimedKeyPoint> keyPoints;
-		for (size_t i = 0; i < predictedKpts.size(); i++) {
-			// Select good points
-			const auto &kpt = predictedKpts[i];
+	/**
+	 * Track points from one pyramid into another. If `parallelBatchSize` is configured and there are more points
+	 * than a single batch, the points are split into batches that are tracked concurrently. Each point is tracked
+	 * independently by the LK algorithm, so the output is the same as tracking all points at once.
+	 * @param from          Pyramid to track from.
+	 * @param to            Pyramid to track into.
+	 * @param points        Point locations on the `from` pyramid.
+	 * @param tracked       Initial location guesses on input, tracked locations on output.
+	 * @param status        Output tracking status, 1 for successfully tracked points.
+	 * @param err           Output tracking error.
+	 * @param lookback      Perform lookback rejection on the tracked points.
+	 */
+	void trackPoints(const ImagePyramid &from, const ImagePyramid &to, const std::vector<cv::Point2f> &points,
+		std::vector<cv::Point2f> &tracked, std::vector<unsigned char> &status, std::vector<float> &err,
+		const bool lookback) const {
+		const size_t batchSize = mConfig.parallelBatchSize;
+		const size_t numPoints = points.size();
+
+		if (batchSize == 0 || numPoints <= batchSize) {
+			trackBatch(*mTracker, from, to, points, tracked, status, err, lookback);
+			return;
+		}
 
-			if (status[i] == 1 && mDetector->isWithinROI(kpt)) {
-				const auto &feat = lastFrameResults->keypoints[i];
-				keyPoints.emplace_back(dv::Point2f(kpt.x, kpt.y), feat.size, feat.angle, err[i], feat.octave,
-					feat.class_id, mCurrentFrame->timestamp);
+		dv::runtime_assert(tracked.size() == numPoints, "Initial guesses must be provided for all tracked points");
+
+		status.resize(numPoints);
+		err.resize(numPoints);
+
+		const int numBatches = static_cast<int>((numPoints + batchSize - 1) / batchSize);
+
+		cv::parallel_for_(cv::Range(0, numBatches), [&](const cv::Range &range) {
+			// The tracker object is not guaranteed to be re-entrant, use a local instance with same parameters
+			auto tracker = cv::SparsePyrLKOpticalFlow::create(mTracker->getWinSize(), mTracker->getMaxLevel(),
+				mTracker->getTermCriteria(), mTracker->getFlags(), mTracker->getMinEigThreshold());
+
+			std::vector<cv::Point2f> batchPoints;
+			std::vector<cv::Point2f> batchTracked;
+			std::vector<unsigned char> batchStatus;
+			std::vector<float> batchErr;
+
+			for (int batch = range.start; batch < range.end; batch++) {
+				const auto begin = static_cast<ptrdiff_t>(static_cast<size_t>(batch) * batchSize);
+				const auto end   = static_cast<ptrdiff_t>(std::min(static_cast<size_t>(begin) + batchSize, numPoints));
+
+				batchPoints.assign(points.begin() + begin, points.begin() + end);
+				batchTracked.assign(tracked.begin() + begin, tracked.begin() + end);
+
+				trackBatch(*tracker, from, to, batchPoints, batchTracked, batchStatus, batchErr, lookback);
+
+				// Batches write into disjoint ranges of the output
+				std::copy(batchTracked.begin(), batchTracked.end(), tracked.begin() + begin);
+				std::copy(batchStatus.begin(), batchStatus.end(), status.begin() + begin);
+				std::copy(batchErr.begin(), batchErr.end(), err.begin() + begin);
 			}
+		});
+	}
+
+	/**
+	 * Perform the LK tracking.
+	 * @return      Result of the tracking.
+	 */
+	[[nodiscard]] Result::SharedPtr track() override {
+		dv::runtime_assert(static_cast<bool>(mCurrentFrame), "Current frame is not passed!");
+
+		// Initialize if we do not have any features
+		if (!mPreviousFrame || lastFrameResults->keypoints.empty()) {
+			auto result         = acquireResult(mCurrentFrame->timestamp, true);
+			const auto detected = mDetector->runDetection(*mCurrentFrame, maxTracks);
+			// Copy into the pooled buffer instead of move-assigning to keep its reserved capacity
+			result->keypoints.assign(detected);
+			mPreviousFrame = std::move(mCurrentFrame);
+			return result;
+		}
+
+		// Perform LK tracking
+		loadPreviousPoints();
+		predictNextPoints(lastFrameResults->timestamp, mPreviousPoints, mCurrentFrame->timestamp, mPredictedPoints);
+
+		// This should never be the case, but let's be careful
+		if (mPredictedPoints.empty()) {
+			mPredictedPoints = mPreviousPoints;
 		}
 
-		bool asKeyframe = false;
+		trackPoints(*mPreviousFrame, *mCurrentFrame, mPreviousPoints, mPredictedPoints, mTrackStatus, mTrackErrors,
+			mLookbackRejection);
+
+		// Fill in the keypoints
+		auto result = acquireResult(mCurrentFrame->timestamp, false);
+		collectTrackedPoints(*result);
 
 		// Decide on redetection of features
 		if (mRedetectionStrategy->decideRedetection(*this)) {
-			cv::Mat mask;
-			if (mConfig.maskedFeatureDetect) {
-				// Disable search on locations where we already have features
-				mask = cv::Mat(mCurrentFrame->pyramid.at(0).size(), CV_8UC1, cv::Scalar(255));
-				for (const auto &feat : keyPoints) {
-					cv::circle(mask, cv::Point2f(feat.pt.x(), feat.pt.y()),
-						static_cast<int>(std::ceil(feat.size / 2.f)), cv::Scalar(0), -1);
-				}
-			}
+			// Disable search on locations where we already have features
+			const cv::Mat mask
+				= mConfig.maskedFeatureDetect ? prepareDetectionMask(result->keypoints, 0.5f) : cv::Mat();
 			// Detect new features
-			std::vector<cv::Point2f> pts;
-			mDetector->runRedetection(keyPoints, *mCurrentFrame, maxTracks, mask);
-			asKeyframe = true;
+			mDetector->runRedetection(result->keypoints, *mCurrentFrame, maxTracks, mask);
+			result->asKeyFrame = true;
 		}
 
 		mPreviousFrame = std::move(mCurrentFrame);
-		return std::make_shared<TrackerBase::Result>(mPreviousFrame->timestamp, keyPoints, asKeyframe);
+		return result;
 	}
 
 	/**
@@ -285,16 +424,47 @@ public:
 				fmt::format("{}x{}", image.image.cols, image.image.rows));
 		}
 
+		if (mPyramidCache) {
+			if (auto cached = mPyramidCache->find(image.timestamp, mConfig.searchWindowSize, mConfig.numPyrLayers - 1);
+				cached) {
+				mCurrentFrame = std::move(cached);
+				return;
+			}
+		}
+
+		ImagePyramid::ConstPtr pyramid;
 		if (image.image.channels() > 1) {
 			cv::Mat grayscale;
 			cv::cvtColor(image.image, grayscale, cv::COLOR_BGR2GRAY);
-			mCurrentFrame = std::make_unique<ImagePyramid>(
+			pyramid = std::make_shared<const ImagePyramid>(
 				image.timestamp, grayscale, mConfig.searchWindowSize, mConfig.numPyrLayers - 1);
 		}
 		else {
-			mCurrentFrame = std::make_unique<ImagePyramid>(
+			pyramid = std::make_shared<const ImagePyramid>(
 				image.timestamp, image.image, mConfig.searchWindowSize, mConfig.numPyrLayers - 1);
 		}
+
+		mCurrentFrame = mPyramidCache
+						  ? mPyramidCache->insert(std::move(pyramid), mConfig.searchWindowSize, mConfig.numPyrLayers - 1)
+						  : std::move(pyramid);
+	}
+
+	/**
+	 * Set a pyramid cache shared with other consumers of the same image stream. Image pyramids of incoming frames
+	 * are taken from the cache if another consumer has already built them with the same window size and number
+	 * of pyramid layers, otherwise the built pyramids are added to the cache.
+	 * @param cache 				Pyramid cache instance, `nullptr` disables caching.
+	 */
+	void setPyramidCache(ImagePyramidCache::SharedPtr cache) {
+		mPyramidCache = std::move(cache);
+	}
+
+	/**
+	 * Get the pyramid cache used by the tracker.
+	 * @return 						Pyramid cache instance, `nullptr` if caching is disabled.
+	 */
+	[[nodiscard]] ImagePyramidCache::SharedPtr getPyramidCache() const {
+		return mPyramidCache;
 	}
 
 	/**
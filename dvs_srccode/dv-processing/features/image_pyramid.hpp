@@ -5,7 +5,10 @@
 #include <opencv2/core.hpp>
 #include <opencv2/video.hpp>
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace dv::features {
 
@@ -16,6 +19,7 @@ class ImagePyramid {
 public:
 	typedef std::shared_ptr<ImagePyramid> SharedPtr;
 	typedef std::unique_ptr<ImagePyramid> UniquePtr;
+	typedef std::shared_ptr<const ImagePyramid> ConstPtr;
 
 	/**
 	 * Timestamp of the image pyramid.
@@ -59,4 +63,117 @@ public:
 	}
 };
 
+/**
+ * Cache of image pyramids shared by the consumers of a single image stream, e.g. a tracker and a detector or
+ * several trackers running on the same frames, so each frame pyramid is only built once. Pyramids are keyed by
+ * frame timestamp, window size and maximum pyramid level. The cache only holds weak references: a pyramid is
+ * released as soon as the last consumer releases it, expired entries are pruned on lookup.
+ *
+ * The cache is thread-safe. A single cache instance must not be shared between different image streams, since
+ * frames of different streams can have the same timestamp, and all consumers are expected to build the pyramids
+ * from the same (e.g. grayscale) image representation.
+ */
+class ImagePyramidCache {
+public:
+	typedef std::shared_ptr<ImagePyramidCache> SharedPtr;
+
+	/**
+	 * Find a cached pyramid.
+	 * @param timestamp         Image timestamp.
+	 * @param winSize           Window size for the search.
+	 * @param maxPyrLevel       Maximum pyramid layer id (zero-based).
+	 * @return                  Cached pyramid, `nullptr` if no consumer holds a pyramid with given parameters.
+	 */
+	[[nodiscard]] ImagePyramid::ConstPtr find(const int64_t timestamp, const cv::Size &winSize, const int maxPyrLevel) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return findLocked(timestamp, winSize, maxPyrLevel);
+	}
+
+	/**
+	 * Insert a pyramid into the cache. If another consumer has inserted a pyramid with the same parameters in the
+	 * meantime, that pyramid is returned instead, so all consumers hold the same instance.
+	 * @param pyramid           Pyramid built by the caller.
+	 * @param winSize           Window size used to build the pyramid.
+	 * @param maxPyrLevel       Maximum pyramid layer id (zero-based) used to build the pyramid.
+	 * @return                  The cached pyramid instance.
+	 */
+	[[nodiscard]] ImagePyramid::ConstPtr insert(
+		ImagePyramid::ConstPtr pyramid, const cv::Size &winSize, const int maxPyrLevel) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (auto cached = findLocked(pyramid->timestamp, winSize, maxPyrLevel); cached) {
+			return cached;
+		}
+		mEntries.push_back(Entry{pyramid->timestamp, winSize, maxPyrLevel, pyramid});
+		return pyramid;
+	}
+
+	/**
+	 * Retrieve a cached pyramid of the image or build and cache a new one. The pyramid is built outside of the
+	 * cache lock, concurrent consumers may build the same pyramid, but only one instance is retained.
+	 * @param timestamp         Image timestamp.
+	 * @param image             Image values.
+	 * @param winSize           Window size for the search.
+	 * @param maxPyrLevel       Maximum pyramid layer id (zero-based).
+	 * @return                  The cached pyramid instance.
+	 */
+	[[nodiscard]] ImagePyramid::ConstPtr get(
+		const int64_t timestamp, const cv::Mat &image, const cv::Size &winSize, const int maxPyrLevel) {
+		if (auto cached = find(timestamp, winSize, maxPyrLevel); cached) {
+			return cached;
+		}
+		return insert(std::make_shared<const ImagePyramid>(timestamp, image, winSize, maxPyrLevel), winSize,
+			maxPyrLevel);
+	}
+
+	/**
+	 * Retrieve a cached pyramid of the frame or build and cache a new one.
+	 * @param frame             dv::Frame containing an image and timestamp.
+	 * @param winSize           Window size for the search.
+	 * @param maxPyrLevel       Maximum pyramid layer id (zero-based).
+	 * @return                  The cached pyramid instance.
+	 */
+	[[nodiscard]] ImagePyramid::ConstPtr get(const dv::Frame &frame, const cv::Size &winSize, const int maxPyrLevel) {
+		return get(frame.timestamp, frame.image, winSize, maxPyrLevel);
+	}
+
+	/**
+	 * Number of pyramids that are currently held by at least one consumer.
+	 * @return                  Number of live cached pyramids.
+	 */
+	[[nodiscard]] size_t size() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return static_cast<size_t>(std::count_if(mEntries.begin(), mEntries.end(), [](const Entry &entry) {
+			return !entry.pyramid.expired();
+		}));
+	}
+
+private:
+	struct Entry {
+		int64_t timestamp;
+		cv::Size winSize;
+		int maxPyrLevel;
+		std::weak_ptr<const ImagePyramid> pyramid;
+	};
+
+	mutable std::mutex mMutex;
+
+	std::vector<Entry> mEntries;
+
+	[[nodiscard]] ImagePyramid::ConstPtr findLocked(
+		const int64_t timestamp, const cv::Size &winSize, const int maxPyrLevel) {
+		std::erase_if(mEntries, [](const Entry &entry) {
+			return entry.pyramid.expired();
+		});
+
+		for (const auto &entry : mEntries) {
+			if (entry.timestamp == timestamp && entry.winSize == winSize && entry.maxPyrLevel == maxPyrLevel) {
+				if (auto pyramid = entry.pyramid.lock(); pyramid) {
+					return pyramid;
+				}
+			}
+		}
+		return nullptr;
+	}
+};
+
 } // namespace dv::features
@@ -1,10 +1,10 @@
 #pragma once
 
 #include "../core/concepts.hpp"
-#include "../data/boost_geometry_interop.hpp"
 
-#include <boost/geometry/geometry.hpp>
-#include <boost/geometry/index/rtree.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace dv::features {
 
@@ -12,6 +12,11 @@ namespace dv::features {
  * Create a feature resampler, which resamples given keypoints with
  * homogenous distribution in pixel space.
  *
+ * Suppression radius is searched with a binary search, for each candidate radius the keypoints are
+ * suppressed in the input order using a uniform grid of keypoint indices with cells no smaller than the
+ * radius, so only neighbouring cells are checked around each retained keypoint. The grid and all
+ * intermediate buffers are kept between calls.
+ *
  * Implementation was inspired by:
  * https://github.com/BAILOOL/ANMS-Codes
  */
@@ -24,7 +29,95 @@ protected:
 	float mCols;
 	float mTolerance = 0.1f;
 
-	typedef std::pair<dv::Point2f, size_t> RangeValue;
+	/**
+	 * Keypoint coordinates of the current call.
+	 */
+	std::vector<float> mX;
+	std::vector<float> mY;
+
+	std::vector<uint8_t> mIncluded;
+	std::vector<size_t> mResult;
+
+	/**
+	 * Uniform grid of keypoint indices in compressed format: indices of keypoints in cell `c` are stored in
+	 * increasing order in `mCellPoints[mCellStart[c]]` to `mCellPoints[mCellStart[c + 1] - 1]`.
+	 */
+	std::vector<uint32_t> mCellStart;
+	std::vector<uint32_t> mCellFill;
+	std::vector<uint32_t> mCellPoints;
+	std::vector<uint32_t> mPointCell;
+	int32_t mGridCols = 0;
+	int32_t mGridRows = 0;
+
+	/**
+	 * Bucket keypoints into a uniform grid with given cell size. Keypoints outside of the image are assigned to
+	 * the closest border cell.
+	 * @param cellSize		Grid cell size in pixels.
+	 */
+	void buildGrid(const float cellSize) {
+		mGridCols = std::max(1, static_cast<int32_t>(std::ceil(mCols / cellSize)));
+		mGridRows = std::max(1, static_cast<int32_t>(std::ceil(mRows / cellSize)));
+
+		const auto numCells = static_cast<size_t>(mGridCols) * static_cast<size_t>(mGridRows);
+		mCellStart.assign(numCells + 1, 0);
+		mPointCell.resize(mX.size());
+		for (size_t i = 0; i < mX.size(); i++) {
+			const auto cx = static_cast<uint32_t>(
+				std::clamp(std::floor(mX[i] / cellSize), 0.f, static_cast<float>(mGridCols - 1)));
+			const auto cy = static_cast<uint32_t>(
+				std::clamp(std::floor(mY[i] / cellSize), 0.f, static_cast<float>(mGridRows - 1)));
+			mPointCell[i] = cy * static_cast<uint32_t>(mGridCols) + cx;
+			mCellStart[mPointCell[i] + 1]++;
+		}
+		for (size_t cell = 0; cell < numCells; cell++) {
+			mCellStart[cell + 1] += mCellStart[cell];
+		}
+
+		mCellFill.assign(mCellStart.begin(), mCellStart.end() - 1);
+		mCellPoints.resize(mX.size());
+		for (size_t i = 0; i < mX.size(); i++) {
+			mCellPoints[mCellFill[mPointCell[i]]++] = static_cast<uint32_t>(i);
+		}
+	}
+
+	/**
+	 * Retain keypoints in input order, suppressing all keypoints within a square of half size `width` around each
+	 * retained keypoint. Grid cells must not be smaller than `width`. Retained keypoint indices are stored in
+	 * `mResult`.
+	 * @param width		Suppression square half size in pixels.
+	 */
+	void suppress(const float width) {
+		mIncluded.assign(mX.size(), 1);
+		mResult.clear();
+
+		for (size_t i = 0; i < mX.size(); i++) {
+			if (!mIncluded[i]) {
+				continue;
+			}
+			mIncluded[i] = 0;
+			mResult.push_back(i);
+
+			// defining square boundaries around the point
+			const float left   = mX[i] - width;
+			const float right  = mX[i] + width;
+			const float top    = mY[i] - width;
+			const float bottom = mY[i] + width;
+
+			const auto cellX = static_cast<int32_t>(mPointCell[i] % static_cast<uint32_t>(mGridCols));
+			const auto cellY = static_cast<int32_t>(mPointCell[i] / static_cast<uint32_t>(mGridCols));
+			for (int32_t y = std::max(cellY - 1, 0); y <= std::min(cellY + 1, mGridRows - 1); y++) {
+				for (int32_t x = std::max(cellX - 1, 0); x <= std::min(cellX + 1, mGridCols - 1); x++) {
+					const auto cell = static_cast<size_t>(y * mGridCols + x);
+					for (uint32_t k = mCellStart[cell]; k < mCellStart[cell + 1]; k++) {
+						const uint32_t j = mCellPoints[k];
+						if (mIncluded[j] && mX[j] >= left && mX[j] <= right && mY[j] >= top && mY[j] <= bottom) {
+							mIncluded[j] = 0;
+						}
+					}
+				}
+			}
+		}
+	}
 
 public:
 	/**
@@ -56,9 +149,6 @@ public:
 			return keyPoints;
 		}
 
-		namespace bg  = boost::geometry;
-		namespace bgi = boost::geometry::index;
-
 		// Typecasting
 		auto K = static_cast<float>(numRetPoints);
 
@@ -76,27 +166,30 @@ public:
 		float high = std::max(sol1, sol2);
 		float low  = std::floor(std::sqrt(static_cast<float>(keyPoints.size()) / K));
 
-		// Packed rangetree search algorithm
-		std::vector<RangeValue> values;
+		mX.resize(keyPoints.size());
+		mY.resize(keyPoints.size());
 		for (size_t i = 0; i < keyPoints.size(); i++) {
 			if constexpr (dv::concepts::KeyPointVector<KeyPointVectorType>) {
 				if constexpr (dv::concepts::Coordinate2DAccessors<decltype(keyPoints[i].pt)>) {
-					values.emplace_back(dv::Point2f(keyPoints[i].pt.x(), keyPoints[i].pt.y()), i);
+					mX[i] = static_cast<float>(keyPoints[i].pt.x());
+					mY[i] = static_cast<float>(keyPoints[i].pt.y());
 				}
 				else {
-					values.emplace_back(dv::Point2f(keyPoints[i].pt.x, keyPoints[i].pt.y), i);
+					mX[i] = static_cast<float>(keyPoints[i].pt.x);
+					mY[i] = static_cast<float>(keyPoints[i].pt.y);
 				}
 			}
 			else {
 				if constexpr (dv::concepts::Coordinate2DAccessors<decltype(keyPoints[i])>) {
-					values.emplace_back(dv::Point2f(keyPoints[i].x(), keyPoints[i].y()), i);
+					mX[i] = static_cast<float>(keyPoints[i].x());
+					mY[i] = static_cast<float>(keyPoints[i].y());
 				}
 				else {
-					values.emplace_back(dv::Point2f(keyPoints[i].x, keyPoints[i].y), i);
+					mX[i] = static_cast<float>(keyPoints[i].x);
+					mY[i] = static_cast<float>(keyPoints[i].y);
 				}
 			}
 		}
-		bgi::rtree<RangeValue, bgi::rstar<4>> rangetree(values.begin(), values.end());
 
 		bool complete   = false;
 		auto Kmin       = static_cast<size_t>(std::round(K - (K * mTolerance)));
@@ -104,12 +197,10 @@ public:
 		float width     = 0.f;
 		float prevwidth = -1.f;
 
-		std::vector<size_t> result;
-		result.reserve(keyPoints.size());
-		dv::BoundingBox queryBox(0, 0.f, 0.f, 0.f, 0.f, 0.f, {});
+		mResult.clear();
+		mResult.reserve(keyPoints.size());
 
 		while (!complete) {
-			std::vector<bool> included(values.size(), true);
 			bool usePreviousSolution = (prevwidth < 0.f && mPreviousSolution > 0.f);
 
 			width = (usePreviousSolution ? mPreviousSolution : (low + ((high - low) / 2.f)));
@@ -117,35 +208,16 @@ public:
 			if (width == prevwidth || low > high) {
 				break;
 			}
-			result.clear();
-
-			for (size_t i = 0; i < values.size(); ++i) {
-				if (included[i]) {
-					included[i] = false;
-					result.push_back(i);
-					const auto &pt = values[i].first;
-					// defining square boundaries around the point
-					queryBox.topLeftX     = pt.x() - width;
-					queryBox.bottomRightX = pt.x() + width;
-					queryBox.topLeftY     = pt.y() - width;
-					queryBox.bottomRightY = pt.y() + width;
-
-					std::vector<RangeValue> result_s;
-					rangetree.query(bgi::covered_by(queryBox), std::back_inserter(result_s));
-
-					for (const auto &j : result_s) {
-						if (included[j.second]) {
-							included[j.second] = false;
-						}
-					}
-				}
-			}
-			if (result.size() >= Kmin && result.size() <= Kmax) { // solution found
+
+			buildGrid(std::max(width, 1.f));
+			suppress(width);
+
+			if (mResult.size() >= Kmin && mResult.size() <= Kmax) { // solution found
 				complete = true;
 			}
 			else if (!usePreviousSolution) {
 				// Update the search range only if we have executed the previous solution search
-				if (result.size() < Kmin) {
+				if (mResult.size() < Kmin) {
 					high = static_cast<int16_t>(width - 1); // update binary search range
 				}
 				else {
@@ -160,8 +232,8 @@ public:
 
 		// retrieve final keypoints
 		KeyPointVectorType output;
-		output.reserve(result.size());
-		for (size_t i : result) {
+		output.reserve(mResult.size());
+		for (size_t i : mResult) {
 			output.push_back(keyPoints[i]);
 		}
 
@@ -70,13 +70,16 @@ public:
 		const cv::Mat normalizedTimeSurface = mSurface.getOCVMatScaled(mTimeWindow.count());
 
 		if ((!lastFrameResults) || (lastFrameResults->keypoints.empty())) {
-			auto newTracks = mDetector->runDetection(mEvents, getMaxTracks());
-			for (auto &track : newTracks) {
+			auto result         = acquireResult(mEvents.getLowestTime(), true);
+			const auto detected = mDetector->runDetection(mEvents, getMaxTracks());
+			// Copy into the pooled buffer instead of move-assigning to keep its reserved capacity
+			result->keypoints.assign(detected);
+			for (auto &track : result->keypoints) {
 				track.class_id   = mLastFreeClassId;
 				mLastFreeClassId += 1;
 			}
 
-			return std::make_shared<TrackerBase::Result>(mEvents.getLowestTime(), newTracks, true);
+			return result;
 		}
 
 		// shift tracks to new position - ID handling is done inside the update
@@ -114,6 +117,18 @@ public:
 		}
 	}
 
+	/**
+	 * Replace the detector with an event blob detector using the event-native occupancy grid detection instead of
+	 * blob detection on an accumulated image. Detection is faster, but sensitivity differs from the default detector
+	 * and keypoint timestamps are the lowest timestamp of the detection events.
+	 * @param params occupancy grid detection parameters
+	 * @sa EventBlobDetector::OccupancyGridParams
+	 */
+	void setOccupancyGridDetector(const EventBlobDetector::OccupancyGridParams &params) {
+		const auto newDetector = std::make_shared<dv::features::EventBlobDetector>(mResolution, 0, params);
+		mDetector              = std::make_unique<dv::features::EventFeatureBlobDetector>(mResolution, newDetector);
+	}
+
 	/**
 	 * Getter for bandwidth value that defines the search area for a new track.
 	 * For detailed information on how the area is computed please check related parameter in constructor.
@@ -234,7 +249,8 @@ private:
 	 * @return updated track positions
 	 */
 	[[nodiscard]] Result::SharedPtr updateTracks(const cv::Mat &normalizedTimeSurface) {
-		dv::cvector<dv::TimedKeyPoint> newTracks;
+		auto result     = acquireResult(mEvents.getLowestTime(), false);
+		auto &newTracks = result->keypoints;
 		std::vector<dv::Point2f> newCenters;
 
 		for (const auto &inputTrack : lastFrameResults->keypoints) {
@@ -262,7 +278,7 @@ private:
 			}
 		}
 
-		return std::make_shared<TrackerBase::Result>(mEvents.getLowestTime(), newTracks, false);
+		return result;
 	}
 
 	/**
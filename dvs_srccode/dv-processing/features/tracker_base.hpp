@@ -2,6 +2,8 @@
 
 #include "feature_detector.hpp"
 
+#include <vector>
+
 namespace dv::features {
 
 /**
@@ -66,6 +68,61 @@ protected:
 	 */
 	Result::SharedPtr lastFrameResults;
 
+	/**
+	 * Pool of reusable result objects, used only if result reuse is enabled.
+	 */
+	std::vector<Result::SharedPtr> resultPool;
+
+	/**
+	 * Whether result objects are reused.
+	 */
+	bool reuseResults = false;
+
+	/**
+	 * Maximum number of result objects kept in the pool.
+	 */
+	size_t resultPoolLimit = 8;
+
+	/**
+	 * Number of result objects allocated by `acquireResult`.
+	 */
+	size_t resultAllocations = 0;
+
+	/**
+	 * Acquire a result object for the output of a tracking step. If result reuse is enabled, a pooled result
+	 * which is not referenced outside of the pool is reset and returned, its keypoint buffer keeps the allocated
+	 * capacity. A new result is allocated if reuse is disabled or all pooled results are held by consumers, it is
+	 * only added to the pool while the pool is below its size limit.
+	 * @param timestamp     Execution time of tracking.
+	 * @param keyframe      Whether the result is a keyframe.
+	 * @return              A result with empty keypoints.
+	 */
+	[[nodiscard]] Result::SharedPtr acquireResult(const int64_t timestamp, const bool keyframe) {
+		if (reuseResults) {
+			// The last frame result is also referenced by `lastFrameResults`, so it is never reused while the
+			// tracker reads it to produce the next result
+			for (const auto &pooled : resultPool) {
+				if (pooled.use_count() == 1) {
+					pooled->keypoints.clear();
+					pooled->asKeyFrame = keyframe;
+					pooled->timestamp  = timestamp;
+					return pooled;
+				}
+			}
+		}
+
+		auto result = std::make_shared<Result>();
+		result->keypoints.reserve(maxTracks);
+		result->asKeyFrame = keyframe;
+		result->timestamp  = timestamp;
+		resultAllocations++;
+
+		if (reuseResults && resultPool.size() < resultPoolLimit) {
+			resultPool.push_back(result);
+		}
+		return result;
+	}
+
 	/**
 	 * Virtual function that is called after all inputs were set.
 	 * This function should perform tracking against `lastFrameResults`.
@@ -90,6 +147,77 @@ public:
 		return maxTracks;
 	}
 
+	/**
+	 * Enable or disable reuse of result objects. With reuse enabled, results are double-buffered: consumers can
+	 * hold the latest result while the tracker writes the next one into another preallocated buffer. A result
+	 * buffer is only reused when no consumer holds a pointer to it, results held for longer cause the pool to
+	 * grow up to the pool size limit, so steady-state tracking does not allocate result objects or keypoint buffers.
+	 * Once the limit is reached, further results are allocated without being pooled.
+	 *
+	 * Consumers must not hold references into a result (e.g. to its keypoints) without holding the result
+	 * pointer itself.
+	 * @param enable        True to enable result reuse.
+	 */
+	void setResultReuse(const bool enable) {
+		reuseResults = enable;
+		resultPool.clear();
+		if (reuseResults) {
+			if (lastFrameResults) {
+				resultPool.push_back(lastFrameResults);
+			}
+			while (resultPool.size() < 2) {
+				auto result = std::make_shared<Result>();
+				result->keypoints.reserve(maxTracks);
+				resultPool.push_back(std::move(result));
+				resultAllocations++;
+			}
+		}
+	}
+
+	/**
+	 * Set the maximum number of result objects kept in the result pool. Consumers holding more results than
+	 * the limit cause result allocations, but the memory retained by the tracker stays bounded. Reducing
+	 * the limit releases the excess pooled results.
+	 * @param limit         Maximum number of pooled results, must be at least 2 to allow double-buffering.
+	 * @throws InvalidArgument Exception is thrown if the limit is below 2.
+	 */
+	void setResultPoolLimit(const size_t limit) {
+		if (limit < 2) {
+			throw dv::exceptions::InvalidArgument<size_t>(
+				"Result pool limit must be at least 2 to allow double-buffering", limit);
+		}
+		resultPoolLimit = limit;
+		if (resultPool.size() > resultPoolLimit) {
+			resultPool.resize(resultPoolLimit);
+		}
+	}
+
+	/**
+	 * Get the maximum number of result objects kept in the result pool.
+	 * @return              Maximum number of pooled results.
+	 */
+	[[nodiscard]] size_t getResultPoolLimit() const {
+		return resultPoolLimit;
+	}
+
+	/**
+	 * Check whether result objects are reused.
+	 * @return              True if result reuse is enabled.
+	 */
+	[[nodiscard]] bool isResultReuseEnabled() const {
+		return reuseResults;
+	}
+
+	/**
+	 * Get the number of result objects allocated by the tracker, including preallocated result buffers. With result
+	 * reuse enabled, the count stays constant during steady-state tracking, which can be used to verify that
+	 * consumers release the results in time.
+	 * @return              Number of allocated result objects.
+	 */
+	[[nodiscard]] size_t getResultAllocationCount() const {
+		return resultAllocations;
+	}
+
 	/**
 	 * Retrieve cached last frame detection results.
 	 * @return		Detection result from the last processed frame.
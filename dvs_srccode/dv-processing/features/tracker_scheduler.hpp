@@ -0,0 +1,371 @@
+#pragma once
+
+#include "../core/core.hpp"
+#include "../core/thread_pool.hpp"
+#include "../data/frame_base.hpp"
+#include "../exception/exceptions/generic_exceptions.hpp"
+#include "tracker_base.hpp"
+
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace dv::features {
+
+/**
+ * Scheduler running multiple independent tracker instances, e.g. one tracker per camera, on a shared thread pool.
+ * Each instance receives its own inputs, processing of the inputs of a single instance is serialized in order of
+ * submission, while different instances are processed concurrently by the workers of the pool. The number of
+ * unprocessed inputs per instance is bounded, submitting an input for an instance that falls behind blocks the
+ * caller, so a slow instance applies backpressure to its producer instead of oversubscribing the cores.
+ *
+ * Latency from input submission to the completion of its tracking and the processing time are recorded per
+ * instance. Tracking results are delivered to a per-instance callback, which is invoked on a worker thread.
+ *
+ * Instances can only be added while no inputs are being processed. Exceptions thrown while processing an input
+ * are rethrown by the next `accept` call of the same instance or by `waitForCompletion`.
+ *
+ * Result callbacks must not submit inputs to their own instance or wait for completion, the worker running the
+ * callback would wait for itself. Both are rejected with an exception. Submitting inputs to other instances
+ * from a callback is allowed, but blocks the worker while the queue of the target instance is full.
+ */
+class TrackerScheduler {
+public:
+	using SharedPtr = std::shared_ptr<TrackerScheduler>;
+	using UniquePtr = std::unique_ptr<TrackerScheduler>;
+
+	/**
+	 * Callback receiving tracking results, the first argument is the index of the tracker instance. The callback
+	 * must not call `accept` for its own instance or `waitForCompletion`.
+	 */
+	using ResultCallback = std::function<void(size_t, const TrackerBase::Result::ConstPtr &)>;
+
+	/**
+	 * Defines how many tracking steps are run after an input is passed into a tracker instance.
+	 * - Once:          Run tracking once per input, for trackers producing a result per input, e.g. image
+	 *                  trackers, `EventCombinedLKTracker` (frame input) or `MeanShiftTracker`.
+	 * - UntilEmpty:    Run tracking until the tracker returns no result, for trackers running at a configured
+	 *                  rate on event input, e.g. `EventFeatureLKTracker` or `EventPatchLKTracker`, where a single
+	 *                  event batch can cover multiple tracking steps.
+	 */
+	enum class RunMode {
+		Once,
+		UntilEmpty
+	};
+
+	/**
+	 * Latency statistics of a tracker instance.
+	 */
+	struct Statistics {
+		/**
+		 * Number of processed inputs.
+		 */
+		size_t inputs = 0;
+
+		/**
+		 * Number of tracking results delivered to the callback.
+		 */
+		size_t results = 0;
+
+		/**
+		 * Time from input submission until its processing completed, including the time spent waiting for
+		 * a worker thread.
+		 */
+		dv::Duration meanLatency = dv::Duration(0);
+		dv::Duration maxLatency  = dv::Duration(0);
+
+		/**
+		 * Time spent processing an input by a worker thread.
+		 */
+		dv::Duration meanProcessingTime = dv::Duration(0);
+		dv::Duration maxProcessingTime  = dv::Duration(0);
+	};
+
+	/**
+	 * Create a tracker scheduler.
+	 * @param pool              Thread pool shared by all tracker instances, defaults to the global pool.
+	 * @param maxInFlight       Maximum number of unprocessed inputs per tracker instance.
+	 */
+	explicit TrackerScheduler(std::shared_ptr<dv::ThreadPool> pool = dv::ThreadPool::global(),
+		const size_t maxInFlight = 4) :
+		mPool(std::move(pool)),
+		mMaxInFlight(maxInFlight) {
+		if (mPool == nullptr) {
+			throw dv::exceptions::NullPointer("Tracker scheduler requires a valid thread pool.");
+		}
+		if (maxInFlight == 0) {
+			throw dv::exceptions::InvalidArgument<size_t>(
+				"Maximum number of in-flight inputs must be at least one.", maxInFlight);
+		}
+	}
+
+	TrackerScheduler(const TrackerScheduler &other)            = delete;
+	TrackerScheduler &operator=(const TrackerScheduler &other) = delete;
+
+	/**
+	 * Destructor waits until all submitted inputs are processed.
+	 */
+	~TrackerScheduler() = default;
+
+	/**
+	 * Add a tracker instance. The tracker can receive inputs of any type that it accepts, event stores and / or
+	 * frames.
+	 * @tparam Tracker          Tracker type.
+	 * @param tracker           Tracker instance, owned by the scheduler.
+	 * @param callback          Callback receiving tracking results, invoked on a worker thread. It must not
+	 *                          submit inputs to its own instance or call `waitForCompletion`.
+	 * @param runMode           Number of tracking steps run after each input.
+	 * @return                  Index of the added instance.
+	 */
+	template<class Tracker>
+	requires std::is_base_of_v<TrackerBase, Tracker>
+	size_t addTracker(
+		std::unique_ptr<Tracker> tracker, ResultCallback callback, const RunMode runMode = RunMode::Once) {
+		if (tracker == nullptr) {
+			throw dv::exceptions::NullPointer("Tracker scheduler requires a valid tracker instance.");
+		}
+
+		auto instance      = std::make_unique<Instance>(mPool, mMaxInFlight);
+		instance->callback = std::move(callback);
+		instance->runMode  = runMode;
+
+		Tracker *typed = tracker.get();
+		if constexpr (requires(Tracker &t, const dv::EventStore &events) { t.accept(events); }) {
+			instance->acceptEvents = [typed](const dv::EventStore &events) {
+				typed->accept(events);
+			};
+		}
+		if constexpr (requires(Tracker &t, const dv::Frame &frame) { t.accept(frame); }) {
+			instance->acceptFrame = [typed](const dv::Frame &frame) {
+				typed->accept(frame);
+			};
+		}
+		instance->tracker = std::move(tracker);
+
+		mInstances.push_back(std::move(instance));
+		return mInstances.size() - 1;
+	}
+
+	/**
+	 * Submit events for processing by a tracker instance. The event store is shallow copied, the data is shared.
+	 * @param index             Tracker instance index.
+	 * @param events            Input events.
+	 * @throws InvalidArgument  If the tracker instance does not accept events.
+	 * @throws RuntimeError     If called from a result callback of the same instance.
+	 */
+	void accept(const size_t index, const dv::EventStore &events) {
+		auto &instance = getInstance(index);
+		if (!instance.acceptEvents) {
+			throw dv::exceptions::InvalidArgument<size_t>("Tracker instance does not accept events.", index);
+		}
+		submit(index, [&instance, events] {
+			instance.acceptEvents(events);
+		});
+	}
+
+	/**
+	 * Submit a frame for processing by a tracker instance. The frame image data is shared, it must not be
+	 * modified until the frame is processed.
+	 * @param index             Tracker instance index.
+	 * @param frame             Input frame.
+	 * @throws InvalidArgument  If the tracker instance does not accept frames.
+	 * @throws RuntimeError     If called from a result callback of the same instance.
+	 */
+	void accept(const size_t index, const dv::Frame &frame) {
+		auto &instance = getInstance(index);
+		if (!instance.acceptFrame) {
+			throw dv::exceptions::InvalidArgument<size_t>("Tracker instance does not accept frames.", index);
+		}
+		submit(index, [&instance, frame] {
+			instance.acceptFrame(frame);
+		});
+	}
+
+	/**
+	 * Block until all submitted inputs of all tracker instances are processed. All instances are waited for
+	 * even if some of them failed, the first exception is rethrown afterwards.
+	 * @throws Rethrows the first exception that was thrown while processing an input.
+	 * @throws RuntimeError     If called from a result callback of this scheduler.
+	 */
+	void waitForCompletion() {
+		for (const auto &instance : mInstances) {
+			if (currentInstance() == instance.get()) {
+				throw dv::exceptions::RuntimeError(
+					"Tracker scheduler cannot wait for completion from within a result callback.");
+			}
+		}
+
+		std::exception_ptr exception;
+		for (auto &instance : mInstances) {
+			try {
+				instance->queue.wait();
+			}
+			catch (...) {
+				if (!exception) {
+					exception = std::current_exception();
+				}
+			}
+		}
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+
+	/**
+	 * Get the number of tracker instances.
+	 * @return                  Number of tracker instances.
+	 */
+	[[nodiscard]] size_t size() const {
+		return mInstances.size();
+	}
+
+	/**
+	 * Access a tracker instance, e.g. to change its configuration. The tracker must not be accessed while inputs
+	 * of the instance are being processed, call `waitForCompletion` first.
+	 * @param index             Tracker instance index.
+	 * @return                  Tracker instance.
+	 */
+	[[nodiscard]] TrackerBase &getTracker(const size_t index) {
+		return *getInstance(index).tracker;
+	}
+
+	/**
+	 * Get latency statistics of a tracker instance.
+	 * @param index             Tracker instance index.
+	 * @return                  Latency statistics since creation or the last reset.
+	 */
+	[[nodiscard]] Statistics getStatistics(const size_t index) const {
+		const auto &instance = getInstance(index);
+		const std::scoped_lock lock(instance.statisticsMutex);
+
+		Statistics statistics;
+		statistics.inputs            = instance.inputs;
+		statistics.results           = instance.results;
+		statistics.maxLatency        = instance.maxLatency;
+		statistics.maxProcessingTime = instance.maxProcessingTime;
+		if (instance.inputs > 0) {
+			const auto inputs             = static_cast<int64_t>(instance.inputs);
+			statistics.meanLatency        = instance.totalLatency / inputs;
+			statistics.meanProcessingTime = instance.totalProcessingTime / inputs;
+		}
+		return statistics;
+	}
+
+	/**
+	 * Reset latency statistics of a tracker instance.
+	 * @param index             Tracker instance index.
+	 */
+	void resetStatistics(const size_t index) {
+		auto &instance = getInstance(index);
+		const std::scoped_lock lock(instance.statisticsMutex);
+		instance.inputs              = 0;
+		instance.results             = 0;
+		instance.totalLatency        = dv::Duration(0);
+		instance.maxLatency          = dv::Duration(0);
+		instance.totalProcessingTime = dv::Duration(0);
+		instance.maxProcessingTime   = dv::Duration(0);
+	}
+
+private:
+	struct Instance {
+		std::unique_ptr<TrackerBase> tracker;
+		std::function<void(const dv::EventStore &)> acceptEvents;
+		std::function<void(const dv::Frame &)> acceptFrame;
+		ResultCallback callback;
+		RunMode runMode = RunMode::Once;
+
+		mutable std::mutex statisticsMutex;
+		size_t inputs                    = 0;
+		size_t results                   = 0;
+		dv::Duration totalLatency        = dv::Duration(0);
+		dv::Duration maxLatency          = dv::Duration(0);
+		dv::Duration totalProcessingTime = dv::Duration(0);
+		dv::Duration maxProcessingTime   = dv::Duration(0);
+
+		// Declared last, so pending inputs are processed before the rest of the instance is destroyed
+		dv::OrderedTaskQueue queue;
+
+		Instance(std::shared_ptr<dv::ThreadPool> pool, const size_t maxInFlight) :
+			queue(std::move(pool), maxInFlight) {
+		}
+	};
+
+	std::shared_ptr<dv::ThreadPool> mPool;
+
+	size_t mMaxInFlight;
+
+	std::vector<std::unique_ptr<Instance>> mInstances;
+
+	[[nodiscard]] Instance &getInstance(const size_t index) const {
+		if (index >= mInstances.size()) {
+			throw dv::exceptions::InvalidArgument<size_t>("Tracker instance index is out of range.", index);
+		}
+		return *mInstances[index];
+	}
+
+	/**
+	 * Instance whose input is being processed by the calling thread, used to reject re-entrant calls from
+	 * result callbacks.
+	 */
+	[[nodiscard]] static const Instance *&currentInstance() {
+		static thread_local const Instance *instance = nullptr;
+		return instance;
+	}
+
+	/**
+	 * Submit an input into the ordered queue of an instance, the task passes the input into the tracker, runs
+	 * tracking and records the statistics.
+	 */
+	void submit(const size_t index, std::function<void()> acceptInput) {
+		auto &instance = *mInstances[index];
+		if (currentInstance() == &instance) {
+			throw dv::exceptions::RuntimeError(
+				"Tracker instance cannot accept inputs from within its own result callback.");
+		}
+		const auto submitted = std::chrono::steady_clock::now();
+
+		instance.queue.submit([&instance, index, submitted, acceptInput = std::move(acceptInput)] {
+			const auto start = std::chrono::steady_clock::now();
+
+			// Mark the instance as running on this worker, so callbacks cannot wait for it
+			currentInstance() = &instance;
+
+			size_t results = 0;
+			try {
+				acceptInput();
+
+				while (auto result = instance.tracker->runTracking()) {
+					results++;
+					if (instance.callback) {
+						instance.callback(index, result);
+					}
+					if (instance.runMode == RunMode::Once) {
+						break;
+					}
+				}
+			}
+			catch (...) {
+				currentInstance() = nullptr;
+				throw;
+			}
+			currentInstance() = nullptr;
+
+			const auto end            = std::chrono::steady_clock::now();
+			const auto latency        = std::chrono::duration_cast<dv::Duration>(end - submitted);
+			const auto processingTime = std::chrono::duration_cast<dv::Duration>(end - start);
+
+			const std::scoped_lock lock(instance.statisticsMutex);
+			instance.inputs++;
+			instance.results             += results;
+			instance.totalLatency        += latency;
+			instance.maxLatency          = std::max(instance.maxLatency, latency);
+			instance.totalProcessingTime += processingTime;
+			instance.maxProcessingTime   = std::max(instance.maxProcessingTime, processingTime);
+		});
+	}
+};
+
+} // namespace dv::features
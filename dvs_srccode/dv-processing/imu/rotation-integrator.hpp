@@ -5,8 +5,10 @@
 #include "../kinematics/transformation.hpp"
 
 #include <Eigen/Geometry>
+#include <Eigen/StdVector>
 
 #include <numbers>
+#include <vector>
 
 namespace dv::imu {
 
@@ -54,7 +56,137 @@ private:
 		return quaternion.matrix();
 	}
 
+	/**
+	 * Quaternion exponential map of a rotation vector.
+	 * @param phi rotation vector [radians]
+	 * @return unit quaternion rotating by |phi| around phi
+	 */
+	[[nodiscard]] static Eigen::Quaternionf expMap(const Eigen::Vector3f &phi) {
+		const float thetaSquared = phi.squaredNorm();
+		float real;
+		float imaginaryScale;
+		if (thetaSquared < 1e-8f) {
+			// Taylor expansion for small angles
+			real           = 1.f - thetaSquared / 8.f;
+			imaginaryScale = 0.5f - thetaSquared / 48.f;
+		}
+		else {
+			const float theta = std::sqrt(thetaSquared);
+			real              = std::cos(0.5f * theta);
+			imaginaryScale    = std::sin(0.5f * theta) / theta;
+		}
+		const Eigen::Vector3f imaginary = phi * imaginaryScale;
+		return Eigen::Quaternionf(real, imaginary.x(), imaginary.y(), imaginary.z()).normalized();
+	}
+
+	/**
+	 * Right Jacobian of SO(3).
+	 * @param phi rotation vector [radians]
+	 * @return [3x3] right Jacobian matrix
+	 */
+	[[nodiscard]] static Eigen::Matrix3f rightJacobian(const Eigen::Vector3f &phi) {
+		const float thetaSquared = phi.squaredNorm();
+		Eigen::Matrix3f skew;
+		skew << 0.f, -phi.z(), phi.y(), phi.z(), 0.f, -phi.x(), -phi.y(), phi.x(), 0.f;
+		if (thetaSquared < 1e-8f) {
+			return Eigen::Matrix3f::Identity() - 0.5f * skew + (1.f / 6.f) * skew * skew;
+		}
+		const float theta = std::sqrt(thetaSquared);
+		return Eigen::Matrix3f::Identity() - ((1.f - std::cos(theta)) / thetaSquared) * skew
+			 + ((theta - std::sin(theta)) / (thetaSquared * theta)) * skew * skew;
+	}
+
 public:
+	/**
+	 * Sensor rotations pre-integrated over a batch of imu samples, together with first order Jacobians of the
+	 * rotations with respect to the gyroscope offset. The Jacobians allow evaluating the integrated rotations for a
+	 * different gyroscope offset without re-integrating the samples:
+	 *
+	 * R_S0_Sk(b) = R_S0_Sk(b0) * Exp(J_k * (b - b0))
+	 *
+	 * where b0 is the gyroscope offset used for integration. The approximation is accurate as long as the change of
+	 * the offset multiplied by the integrated duration is small.
+	 */
+	struct Preintegration {
+		/**
+		 * Timestamps of the integrated samples in target time.
+		 */
+		std::vector<int64_t> timestamps;
+
+		/**
+		 * Sensor orientations wrt the orientation at the first sample, integrated with `gyroscopeOffset`.
+		 */
+		std::vector<Eigen::Quaternionf, Eigen::aligned_allocator<Eigen::Quaternionf>> rotations;
+
+		/**
+		 * Jacobians of the rotations (right perturbation) wrt the gyroscope offset.
+		 */
+		std::vector<Eigen::Matrix3f, Eigen::aligned_allocator<Eigen::Matrix3f>> offsetJacobians;
+
+		/**
+		 * Gyroscope offset [radians] used for integration.
+		 */
+		Eigen::Vector3f gyroscopeOffset = Eigen::Vector3f::Zero();
+
+		/**
+		 * Target position wrt to the sensor.
+		 */
+		Eigen::Matrix4f T_S0_target = Eigen::Matrix4f::Identity();
+
+		/**
+		 * Number of pre-integrated samples.
+		 * @return number of samples
+		 */
+		[[nodiscard]] size_t size() const {
+			return timestamps.size();
+		}
+
+		/**
+		 * Check whether no samples were pre-integrated.
+		 * @return true if empty, false otherwise
+		 */
+		[[nodiscard]] bool empty() const {
+			return timestamps.empty();
+		}
+
+		/**
+		 * Sensor orientation at the given sample wrt the orientation at the first sample, corrected for a different
+		 * gyroscope offset.
+		 * @param index sample index
+		 * @param offset gyroscope offset [radians]
+		 * @return sensor orientation quaternion
+		 */
+		[[nodiscard]] Eigen::Quaternionf getSensorRotation(const size_t index, const Eigen::Vector3f &offset) const {
+			return rotations[index] * expMap(offsetJacobians[index] * (offset - gyroscopeOffset));
+		}
+
+		/**
+		 * Target rotation at the given sample relative to the initial one, corrected for a different gyroscope offset.
+		 * Corresponds to `RotationIntegrator::getRotation` after integrating the samples up to the index.
+		 * @param index sample index
+		 * @param offset gyroscope offset [radians]
+		 * @return [3x3] rotation matrix
+		 */
+		[[nodiscard]] Eigen::Matrix3f getRotation(const size_t index, const Eigen::Vector3f &offset) const {
+			return getSensorRotation(index, offset).matrix() * T_S0_target.block<3, 3>(0, 0).transpose();
+		}
+
+		/**
+		 * Target transformation at the given sample relative to the initial one, corrected for a different gyroscope
+		 * offset. Corresponds to `RotationIntegrator::getTransformation` after integrating the samples up to the index.
+		 * @param index sample index
+		 * @param offset gyroscope offset [radians]
+		 * @return 4x4 transformation corresponding to integrated rotation
+		 */
+		[[nodiscard]] dv::kinematics::Transformation<float> getTransformation(
+			const size_t index, const Eigen::Vector3f &offset) const {
+			Eigen::Matrix4f T_S0_S          = Eigen::Matrix4f::Identity();
+			T_S0_S.block<3, 3>(0, 0)        = getSensorRotation(index, offset).matrix();
+			const Eigen::Matrix4f T_target_S = T_S0_S * T_S0_target.transpose();
+			return {timestamps[index], T_target_S};
+		}
+	};
+
 	/**
 	 *
 	 * @param T_S_target initial target position wrt to sensor
@@ -87,6 +219,22 @@ public:
 		mT_S0_target = T_S_target.getTransform();
 	}
 
+	/**
+	 * Getter returning the gyroscope measurement offset
+	 * @return gyroscope offset [radians]
+	 */
+	[[nodiscard]] const Eigen::Vector3f &getGyroscopeOffset() const {
+		return mGyroscopeOffset;
+	}
+
+	/**
+	 * Setter to update the gyroscope measurement offset, applies to samples integrated afterwards
+	 * @param gyroscopeOffset new gyroscope offset [radians]
+	 */
+	void setGyroscopeOffset(const Eigen::Vector3f &gyroscopeOffset) {
+		mGyroscopeOffset = gyroscopeOffset;
+	}
+
 	/**
 	 * Getter outputting timestamp of current target transformation
 	 * @return timestamp
@@ -127,6 +275,54 @@ public:
 
 		mTimestamp = timestamp;
 	}
+
+	/**
+	 * Pre-integrate a batch of imu samples using the configured target transformation, time offset and gyroscope
+	 * offset. Integration starts from identity at the first sample and does not modify the integrator state.
+	 * The result can be evaluated for other gyroscope offsets without re-integrating the samples.
+	 *
+	 * Sample rotations are computed with the exponential map of the rotation vector, which the offset Jacobians
+	 * are derived for, while `accept()` composes the rotations around the individual axes. The difference is of
+	 * second order in the per-sample rotation angle.
+	 * @param samples imu measurements in increasing time order
+	 * @return pre-integrated rotations and their gyroscope offset Jacobians
+	 */
+	[[nodiscard]] Preintegration preintegrate(const dv::cvector<dv::IMU> &samples) const {
+		Preintegration result;
+		result.gyroscopeOffset = mGyroscopeOffset;
+		result.T_S0_target     = mT_S0_target;
+
+		const size_t count = samples.size();
+		if (count == 0) {
+			return result;
+		}
+
+		result.timestamps.resize(count);
+		result.rotations.resize(count);
+		result.offsetJacobians.resize(count);
+
+		// Rotation vectors and durations of all samples are independent, compute them in a single pass
+		std::vector<Eigen::Vector3f, Eigen::aligned_allocator<Eigen::Vector3f>> increments(count);
+		std::vector<float> durations(count, 0.f);
+		for (size_t i = 0; i < count; i++) {
+			result.timestamps[i] = samples[i].timestamp - mSensorToTargetTimeOffset;
+		}
+		for (size_t i = 1; i < count; i++) {
+			durations[i]  = static_cast<float>(result.timestamps[i] - result.timestamps[i - 1]) * 1e-6f;
+			increments[i] = (samples[i].getAngularVelocities() - mGyroscopeOffset) * durations[i];
+		}
+
+		result.rotations[0]       = Eigen::Quaternionf::Identity();
+		result.offsetJacobians[0] = Eigen::Matrix3f::Zero();
+		for (size_t i = 1; i < count; i++) {
+			const Eigen::Quaternionf increment = expMap(increments[i]);
+			result.rotations[i]                = (result.rotations[i - 1] * increment).normalized();
+			result.offsetJacobians[i]          = increment.matrix().transpose() * result.offsetJacobians[i - 1]
+									  - rightJacobian(increments[i]) * durations[i];
+		}
+
+		return result;
+	}
 };
 
 static_assert(dv::concepts::Accepts<RotationIntegrator, dv::IMU>);
@@ -1,12 +1,16 @@
 #pragma once
 
+#include "../exception/exceptions/generic_exceptions.hpp"
 #include "transformation.hpp"
 
 #include <Eigen/Dense>
 #include <Eigen/StdVector>
-#include <boost/circular_buffer.hpp>
 
+#include <atomic>
+#include <iterator>
 #include <optional>
+#include <span>
+#include <vector>
 
 namespace dv::kinematics {
 
@@ -14,24 +18,357 @@ namespace dv::kinematics {
  * A buffer containing time increasing 3D transformations and capable of timewise linear interpolation
  * between available transforms. Can be used with different underlying floating point types supported
  * by Eigen.
+ *
+ * Transformations are stored in a fixed capacity ring buffer in structure-of-arrays layout: timestamps,
+ * translations and rotation quaternions are kept in separate arrays, so time lookups only touch contiguous
+ * timestamps and interpolation does not need to extract quaternions from rotation matrices. Lookups remember
+ * the last found position, so monotonically increasing queries resolve in constant time.
  * @tparam Scalar Underlying floating point number type - float or double.
  */
 template<std::floating_point Scalar>
 class LinearTransformer {
 private:
 	using TransformationType = Transformation<Scalar>;
-	using TransformationBuffer
-		= boost::circular_buffer<TransformationType, Eigen::aligned_allocator<TransformationType>>;
+	using Vector3            = Eigen::Matrix<Scalar, 3, 1>;
+	using Quaternion         = Eigen::Quaternion<Scalar>;
 
-	TransformationBuffer mTransforms;
+	/**
+	 * Copyable atomic lookup position. It is only used as a search hint, so relaxed ordering is sufficient and
+	 * concurrent const lookups stay safe.
+	 */
+	struct LookupCursor {
+		std::atomic<uint64_t> sequence = 0;
+
+		LookupCursor() = default;
+
+		LookupCursor(const LookupCursor &other) : sequence(other.sequence.load(std::memory_order_relaxed)) {
+		}
+
+		LookupCursor &operator=(const LookupCursor &other) {
+			sequence.store(other.sequence.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			return *this;
+		}
+	};
+
+	/**
+	 * Number of samples scanned linearly from the cached cursor before falling back to binary search.
+	 */
+	static constexpr size_t CursorScanLength = 4;
+
+	std::vector<int64_t> mTimestamps;
+	std::vector<Vector3, Eigen::aligned_allocator<Vector3>> mTranslations;
+	std::vector<Quaternion, Eigen::aligned_allocator<Quaternion>> mRotations;
+
+	/**
+	 * Storage index of the earliest transformation.
+	 */
+	size_t mHead = 0;
+
+	/**
+	 * Number of transformations in the buffer.
+	 */
+	size_t mSize = 0;
+
+	/**
+	 * Total number of transformations dropped from the front of the buffer. Logical index `i` corresponds to the
+	 * sequence number `mDropped + i`, which stays stable while the buffer is rotating.
+	 */
+	uint64_t mDropped = 0;
+
+	/**
+	 * Sequence number of the transformation found by the latest lookup.
+	 */
+	mutable LookupCursor mCursor;
 
 public:
 	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
-	using iterator       = typename TransformationBuffer::iterator;
-	using const_iterator = typename TransformationBuffer::const_iterator;
+	/**
+	 * Random access iterator over the transformations. The transformations are assembled from the internal
+	 * storage on access, so the iterator dereferences into values instead of references.
+	 */
+	class const_iterator {
+	private:
+		const LinearTransformer *mParent = nullptr;
+		size_t mIndex                    = 0;
+
+		/**
+		 * Holder of a dereferenced transformation to support member access through the iterator.
+		 */
+		struct ArrowProxy {
+			TransformationType value;
+
+			const TransformationType *operator->() const {
+				return &value;
+			}
+		};
+
+	public:
+		using iterator_category = std::random_access_iterator_tag;
+		using value_type        = TransformationType;
+		using difference_type   = std::ptrdiff_t;
+		using pointer           = ArrowProxy;
+		using reference         = TransformationType;
+
+		const_iterator() = default;
+
+		const_iterator(const LinearTransformer *parent, const size_t index) : mParent(parent), mIndex(index) {
+		}
+
+		[[nodiscard]] reference operator*() const {
+			return mParent->transformationAt(mIndex);
+		}
+
+		[[nodiscard]] pointer operator->() const {
+			return ArrowProxy{mParent->transformationAt(mIndex)};
+		}
+
+		[[nodiscard]] reference operator[](const difference_type offset) const {
+			return mParent->transformationAt(static_cast<size_t>(static_cast<difference_type>(mIndex) + offset));
+		}
+
+		/**
+		 * Timestamp of the pointed transformation, available without assembling the transformation.
+		 * @return 		Unix timestamp in microseconds.
+		 */
+		[[nodiscard]] int64_t timestamp() const {
+			return mParent->timestampAt(mIndex);
+		}
+
+		const_iterator &operator++() {
+			mIndex++;
+			return *this;
+		}
+
+		const_iterator operator++(int) {
+			const_iterator current = *this;
+			mIndex++;
+			return current;
+		}
+
+		const_iterator &operator--() {
+			mIndex--;
+			return *this;
+		}
+
+		const_iterator operator--(int) {
+			const_iterator current = *this;
+			mIndex--;
+			return current;
+		}
+
+		const_iterator &operator+=(const difference_type offset) {
+			mIndex = static_cast<size_t>(static_cast<difference_type>(mIndex) + offset);
+			return *this;
+		}
+
+		const_iterator &operator-=(const difference_type offset) {
+			return *this += -offset;
+		}
+
+		[[nodiscard]] const_iterator operator+(const difference_type offset) const {
+			const_iterator result = *this;
+			return result += offset;
+		}
+
+		[[nodiscard]] friend const_iterator operator+(const difference_type offset, const const_iterator &iter) {
+			return iter + offset;
+		}
+
+		[[nodiscard]] const_iterator operator-(const difference_type offset) const {
+			const_iterator result = *this;
+			return result -= offset;
+		}
+
+		[[nodiscard]] difference_type operator-(const const_iterator &other) const {
+			return static_cast<difference_type>(mIndex) - static_cast<difference_type>(other.mIndex);
+		}
+
+		[[nodiscard]] bool operator==(const const_iterator &other) const {
+			return mIndex == other.mIndex;
+		}
+
+		[[nodiscard]] auto operator<=>(const const_iterator &other) const {
+			return mIndex <=> other.mIndex;
+		}
+	};
+
+	using iterator = const_iterator;
+
+	/**
+	 * Non-owning view of a contiguous range of transformations in a transformer. The view does not allocate and
+	 * provides the same lookup and interpolation functionality as the transformer over the viewed range. The view
+	 * is invalidated by any modification of the transformer.
+	 */
+	class View {
+	private:
+		const LinearTransformer *mParent = nullptr;
+		size_t mFirst                    = 0;
+		size_t mSize                     = 0;
+
+	public:
+		View() = default;
+
+		View(const LinearTransformer *parent, const size_t first, const size_t size) :
+			mParent(parent),
+			mFirst(first),
+			mSize(size) {
+		}
+
+		/**
+		 * Generate a const forward iterator pointing to first transformation in the view.
+		 * @return 		View start const-iterator.
+		 */
+		[[nodiscard]] const_iterator begin() const {
+			return const_iterator(mParent, mFirst);
+		}
+
+		/**
+		 * Generate a const iterator representing end of the view.
+		 * @return 		View end const-iterator.
+		 */
+		[[nodiscard]] const_iterator end() const {
+			return const_iterator(mParent, mFirst + mSize);
+		}
+
+		/**
+		 * Generate a const forward iterator pointing to first transformation in the view.
+		 * @return 		View start const-iterator.
+		 */
+		[[nodiscard]] const_iterator cbegin() const {
+			return begin();
+		}
+
+		/**
+		 * Generate a const iterator representing end of the view.
+		 * @return 		View end const-iterator.
+		 */
+		[[nodiscard]] const_iterator cend() const {
+			return end();
+		}
+
+		/**
+		 * Return the number of transformations in the view.
+		 * @return Number of viewed transformations.
+		 */
+		[[nodiscard]] size_t size() const {
+			return mSize;
+		}
+
+		/**
+		 * Check whether the view is empty.
+		 * @return true if empty, false otherwise
+		 */
+		[[nodiscard]] bool empty() const {
+			return mSize == 0;
+		}
+
+		/**
+		 * Return transformation with lowest timestamp in the view.
+		 * @return Earliest transformation in the view.
+		 */
+		[[nodiscard]] TransformationType earliestTransformation() const {
+			return mParent->transformationAt(mFirst);
+		}
+
+		/**
+		 * Return transformation with highest timestamp in the view.
+		 * @return Latest transformation in the view.
+		 */
+		[[nodiscard]] TransformationType latestTransformation() const {
+			return mParent->transformationAt(mFirst + mSize - 1);
+		}
+
+		/**
+		 * Checks whether the timestamp is within the range of viewed transformations.
+		 * @param timestamp Unix microsecond timestamp to be checked.
+		 * @return true if the timestamp is within the range of viewed transformations.
+		 */
+		[[nodiscard]] bool isWithinTimeRange(const int64_t timestamp) const {
+			return mSize > 0 && mParent->timestampAt(mFirst) <= timestamp
+				&& mParent->timestampAt(mFirst + mSize - 1) >= timestamp;
+		}
+
+		/**
+		 * Get a transform at the given timestamp.
+		 *
+		 * If no transform with the exact timestamp is available, estimates a transform assuming linear motion.
+		 * @param timestamp Unix timestamp in microsecond format.
+		 * @return Transformation if successful, std::nullopt otherwise.
+		 */
+		[[nodiscard]] std::optional<TransformationType> getTransformAt(const int64_t timestamp) const {
+			if (!isWithinTimeRange(timestamp)) {
+				return std::nullopt;
+			}
+			return mParent->interpolateAt(mParent->lowerBound(mFirst, mFirst + mSize, timestamp), timestamp);
+		}
+
+		/**
+		 * Get transforms at multiple timestamps. Timestamps are not required to be sorted, but monotonically
+		 * increasing timestamps are resolved without searching.
+		 * @param timestamps 	Unix timestamps in microsecond format.
+		 * @param output 		Output transformations, an element is set to std::nullopt if the timestamp is out of
+		 * 						range. Must have the same size as the timestamps.
+		 * @return 				Number of successfully estimated transformations.
+		 */
+		size_t getTransformsAt(
+			std::span<const int64_t> timestamps, std::span<std::optional<TransformationType>> output) const {
+			if (output.size() != timestamps.size()) {
+				throw dv::exceptions::InvalidArgument<size_t>(
+					"Output size does not match the number of timestamps.", output.size());
+			}
+
+			size_t count = 0;
+			for (size_t i = 0; i < timestamps.size(); i++) {
+				output[i] = getTransformAt(timestamps[i]);
+				if (output[i].has_value()) {
+					count++;
+				}
+			}
+			return count;
+		}
+
+		/**
+		 * Resample viewed transforms into a new transformer, containing interpolated transforms at given interval.
+		 * Will contain the last transformation as well, although the interval might not be maintained for the last
+		 * transform.
+		 * @param samplingInterval Interval in microseconds at which to resample the transformations.
+		 * @return Generated transformer with exact capacity of output transformation count.
+		 */
+		[[nodiscard]] LinearTransformer<Scalar> resampleTransforms(const int64_t samplingInterval) const {
+			if (samplingInterval <= 0) {
+				throw dv::exceptions::InvalidArgument<int64_t>(
+					"Sampling interval must be a positive value.", samplingInterval);
+			}
 
-	explicit LinearTransformer(size_t capacity) : mTransforms(capacity) {
+			if (mSize == 0) {
+				return LinearTransformer<Scalar>(mParent->capacity());
+			}
+
+			const size_t last   = mFirst + mSize - 1;
+			const int64_t start = mParent->timestampAt(mFirst);
+			const int64_t end   = mParent->timestampAt(last);
+
+			LinearTransformer<Scalar> transformer((static_cast<size_t>((end - start) / samplingInterval)) + 2);
+
+			// Sampling times are increasing, so the interpolation interval only moves forward
+			size_t index = mFirst;
+			for (int64_t now = start; now < end; now += samplingInterval) {
+				while (mParent->timestampAt(index) < now) {
+					index++;
+				}
+				const auto interpolated = mParent->interpolateAt(index, now);
+				transformer.append(now, interpolated.getTranslation(), interpolated.getQuaternion());
+			}
+			transformer.append(end, mParent->translationAt(last), mParent->rotationAt(last));
+			return transformer;
+		}
+	};
+
+	explicit LinearTransformer(size_t capacity) :
+		mTimestamps(capacity),
+		mTranslations(capacity),
+		mRotations(capacity) {
 	}
 
 	/**
@@ -41,8 +378,9 @@ public:
 	 * to latest transformation in the buffer, otherwise an exception will be thrown.
 	 */
 	void pushTransformation(const TransformationType &transformation) {
-		if (mTransforms.empty() || transformation.getTimestamp() > mTransforms.back().getTimestamp()) {
-			mTransforms.push_back(transformation);
+		if (mSize == 0 || transformation.getTimestamp() > timestampAt(mSize - 1)) {
+			append(
+				transformation.getTimestamp(), transformation.getTranslation(), transformation.getQuaternion().normalized());
 		}
 		else {
 			throw std::logic_error(
@@ -54,16 +392,16 @@ public:
 	 * Generate forward iterator pointing to first transformation in the transformer buffer.
 	 * @return 		Buffer start iterator.
 	 */
-	[[nodiscard]] iterator begin() {
-		return mTransforms.begin();
+	[[nodiscard]] iterator begin() const {
+		return const_iterator(this, 0);
 	}
 
 	/**
 	 * Generate an iterator representing end of the buffer.
 	 * @return 		Buffer end const-iterator.
 	 */
-	[[nodiscard]] iterator end() {
-		return mTransforms.end();
+	[[nodiscard]] iterator end() const {
+		return const_iterator(this, mSize);
 	}
 
 	/**
@@ -71,7 +409,7 @@ public:
 	 * @return 		Buffer start const-iterator.
 	 */
 	[[nodiscard]] const_iterator cbegin() const {
-		return mTransforms.cbegin();
+		return begin();
 	}
 
 	/**
@@ -79,14 +417,16 @@ public:
 	 * @return 		Buffer end iterator.
 	 */
 	[[nodiscard]] const_iterator cend() const {
-		return mTransforms.cend();
+		return end();
 	}
 
 	/**
 	 * Delete all transformations from the buffer.
 	 */
 	inline void clear() {
-		mTransforms.clear();
+		mDropped += mSize;
+		mHead = 0;
+		mSize = 0;
 	}
 
 	/**
@@ -94,7 +434,7 @@ public:
 	 * @return true if empty, false otherwise
 	 */
 	[[nodiscard]] inline bool empty() const {
-		return mTransforms.empty();
+		return mSize == 0;
 	}
 
 	/**
@@ -105,24 +445,20 @@ public:
 	 * @return Transformation if successful, std::nullopt otherwise.
 	 */
 	[[nodiscard]] std::optional<TransformationType> getTransformAt(int64_t timestamp) const {
-		if (isWithinTimeRange(timestamp)) {
-			auto T_b = bufferLowerBound(timestamp);
-			if (T_b->getTimestamp() == timestamp) {
-				return *T_b;
-			}
-			auto T_a = std::prev(T_b);
-			if (T_a->getTimestamp() == timestamp) {
-				return *T_a;
-			}
-			auto distance = static_cast<Scalar>(T_b->getTimestamp() - T_a->getTimestamp());
-			auto lambda   = static_cast<Scalar>(timestamp - T_a->getTimestamp()) / distance;
+		return view().getTransformAt(timestamp);
+	}
 
-			TransformationType interpolated = interpolateComponentwise(*T_a, *T_b, timestamp, lambda);
-			return interpolated;
-		}
-		else {
-			return std::nullopt;
-		}
+	/**
+	 * Get transforms at multiple timestamps. Timestamps are not required to be sorted, but monotonically
+	 * increasing timestamps are resolved without searching.
+	 * @param timestamps 	Unix timestamps in microsecond format.
+	 * @param output 		Output transformations, an element is set to std::nullopt if the timestamp is out of
+	 * 						range. Must have the same size as the timestamps.
+	 * @return 				Number of successfully estimated transformations.
+	 */
+	size_t getTransformsAt(
+		std::span<const int64_t> timestamps, std::span<std::optional<TransformationType>> output) const {
+		return view().getTransformsAt(timestamps, output);
 	}
 
 	/**
@@ -131,14 +467,7 @@ public:
 	 * @return true if the timestamp is within the range of transformations in the buffer.
 	 */
 	[[nodiscard]] inline bool isWithinTimeRange(int64_t timestamp) const {
-		if (mTransforms.empty()) {
-			return false;
-		}
-
-		if (mTransforms.front().getTimestamp() <= timestamp && mTransforms.back().getTimestamp() >= timestamp) {
-			return true;
-		}
-		return false;
+		return view().isWithinTimeRange(timestamp);
 	}
 
 	/**
@@ -146,23 +475,31 @@ public:
 	 * @return Number of transformations available in the buffer.
 	 */
 	[[nodiscard]] inline size_t size() const {
-		return mTransforms.size();
+		return mSize;
+	}
+
+	/**
+	 * Return the capacity of the buffer.
+	 * @return Maximum number of transformations stored in the buffer.
+	 */
+	[[nodiscard]] inline size_t capacity() const {
+		return mTimestamps.size();
 	}
 
 	/**
 	 * Return transformation with highest timestamp.
 	 * @return Latest transformation in the buffer.
 	 */
-	[[nodiscard]] inline const TransformationType &latestTransformation() const {
-		return mTransforms.back();
+	[[nodiscard]] inline TransformationType latestTransformation() const {
+		return transformationAt(mSize - 1);
 	}
 
 	/**
 	 * Return transformation with lowest timestamp.
 	 * @return Earliest transformation in time available in the buffer.
 	 */
-	[[nodiscard]] inline const TransformationType &earliestTransformation() const {
-		return mTransforms.front();
+	[[nodiscard]] inline TransformationType earliestTransformation() const {
+		return transformationAt(0);
 	}
 
 	/**
@@ -171,7 +508,62 @@ public:
 	 * @param newCapacity New transformation buffer capacity.
 	 */
 	inline void setCapacity(size_t newCapacity) {
-		mTransforms.rset_capacity(newCapacity);
+		const size_t retained = std::min(mSize, newCapacity);
+		const size_t skipped  = mSize - retained;
+
+		std::vector<int64_t> timestamps(newCapacity);
+		std::vector<Vector3, Eigen::aligned_allocator<Vector3>> translations(newCapacity);
+		std::vector<Quaternion, Eigen::aligned_allocator<Quaternion>> rotations(newCapacity);
+		for (size_t i = 0; i < retained; i++) {
+			const size_t index = storageIndex(skipped + i);
+			timestamps[i]      = mTimestamps[index];
+			translations[i]    = mTranslations[index];
+			rotations[i]       = mRotations[index];
+		}
+
+		mTimestamps   = std::move(timestamps);
+		mTranslations = std::move(translations);
+		mRotations    = std::move(rotations);
+		mHead         = 0;
+		mSize         = retained;
+		mDropped     += skipped;
+	}
+
+	/**
+	 * Get a view of all transformations in the buffer.
+	 * @return View over the full buffer.
+	 */
+	[[nodiscard]] View view() const {
+		return View(this, 0, mSize);
+	}
+
+	/**
+	 * Get a view of transformations between two given timestamps without copying them. The view selects the
+	 * same transformations as `getTransformsBetween`.
+	 * @param start Start Unix timestamp in microseconds.
+	 * @param end End Unix timestamp in microseconds.
+	 * @return View of transformations covering the given period.
+	 */
+	[[nodiscard]] View viewBetween(int64_t start, int64_t end) const {
+		if (mSize == 0) {
+			return view();
+		}
+
+		const size_t lower = lowerBound(0, mSize, start);
+		if (lower == mSize) {
+			// Period starts after the latest transformation
+			return View(this, mSize - 1, 1);
+		}
+
+		const size_t first = lower > 0 ? lower - 1 : lower;
+		size_t last        = lower;
+		while (last < mSize && timestampAt(last) <= end) {
+			last++;
+		}
+		if (last < mSize) {
+			last++;
+		}
+		return View(this, first, last - first);
 	}
 
 	/**
@@ -183,27 +575,12 @@ public:
 	 * @return LinearTransformer containing transformations covering the given period.
 	 */
 	[[nodiscard]] LinearTransformer<Scalar> getTransformsBetween(int64_t start, int64_t end) const {
-		LinearTransformer<Scalar> transformer(mTransforms.capacity());
-		auto iter = bufferLowerBound(start);
-		if (iter != mTransforms.end() && iter != mTransforms.begin()) {
-			auto prevIter = std::prev(iter);
-			transformer.pushTransformation(*prevIter);
-		}
-		while (iter != mTransforms.end() && iter->getTimestamp() <= end) {
-			transformer.pushTransformation(*iter);
-			iter++;
-		}
-		if (iter != mTransforms.end()) {
-			transformer.pushTransformation(*iter);
-		}
-		if (transformer.empty()) {
-			auto enditer = bufferLowerBound(end);
-			if (enditer != mTransforms.end()) {
-				transformer.pushTransformation(*enditer);
-			}
-			else {
-				transformer.pushTransformation(mTransforms.back());
-			}
+		LinearTransformer<Scalar> transformer(capacity());
+		const View range  = viewBetween(start, end);
+		const auto first = static_cast<size_t>(range.begin() - begin());
+		for (size_t i = first; i < first + range.size(); i++) {
+			const size_t index = storageIndex(i);
+			transformer.append(mTimestamps[index], mTranslations[index], mRotations[index]);
 		}
 		return transformer;
 	}
@@ -216,68 +593,139 @@ public:
 	 * @return Generated transformer with exact capacity of output transformation count.
 	 */
 	[[nodiscard]] LinearTransformer<Scalar> resampleTransforms(const int64_t samplingInterval) const {
-		if (mTransforms.empty()) {
-			return LinearTransformer<Scalar>(mTransforms.capacity());
+		return view().resampleTransforms(samplingInterval);
+	}
+
+private:
+	/**
+	 * Append a transformation to the end of the buffer, overwriting the earliest transformation if the buffer is
+	 * full. Timestamp ordering is not checked.
+	 */
+	void append(const int64_t timestamp, const Vector3 &translation, const Quaternion &rotation) {
+		if (mTimestamps.empty()) {
+			return;
 		}
 
-		int64_t start = mTransforms.front().getTimestamp();
-		int64_t end   = mTransforms.back().getTimestamp();
-		int64_t now   = start;
-		LinearTransformer<Scalar> transformer((static_cast<size_t>((end - start) / samplingInterval)) + 2);
-		while (now < end) {
-			if (auto tf = getTransformAt(now)) {
-				transformer.pushTransformation(*tf);
-			}
-			now += samplingInterval;
+		size_t index;
+		if (mSize == mTimestamps.size()) {
+			index = mHead;
+			mHead = storageIndex(1);
+			mDropped++;
 		}
-		transformer.pushTransformation(mTransforms.back());
-		return transformer;
+		else {
+			index = storageIndex(mSize);
+			mSize++;
+		}
+
+		mTimestamps[index]   = timestamp;
+		mTranslations[index] = translation;
+		mRotations[index]    = rotation;
+	}
+
+	/**
+	 * Convert a logical index, counted from the earliest transformation, into the ring buffer storage index.
+	 */
+	[[nodiscard]] size_t storageIndex(const size_t index) const {
+		const size_t storage = mHead + index;
+		return storage >= mTimestamps.size() ? storage - mTimestamps.size() : storage;
+	}
+
+	[[nodiscard]] int64_t timestampAt(const size_t index) const {
+		return mTimestamps[storageIndex(index)];
+	}
+
+	[[nodiscard]] const Vector3 &translationAt(const size_t index) const {
+		return mTranslations[storageIndex(index)];
+	}
+
+	[[nodiscard]] const Quaternion &rotationAt(const size_t index) const {
+		return mRotations[storageIndex(index)];
+	}
+
+	[[nodiscard]] TransformationType transformationAt(const size_t index) const {
+		const size_t storage = storageIndex(index);
+		return TransformationType(mTimestamps[storage], mTranslations[storage], mRotations[storage]);
+	}
+
+	/**
+	 * Estimate the transformation at the given timestamp.
+	 * @param upper Logical index of the first transformation with timestamp not less than the given timestamp.
+	 * @param timestamp Unix timestamp in microseconds.
+	 * @return Stored transformation if the timestamp matches exactly, interpolated transformation otherwise.
+	 */
+	[[nodiscard]] TransformationType interpolateAt(const size_t upper, const int64_t timestamp) const {
+		const int64_t upperTimestamp = timestampAt(upper);
+		if (upperTimestamp == timestamp) {
+			return transformationAt(upper);
+		}
+
+		const int64_t lowerTimestamp = timestampAt(upper - 1);
+		const auto lambda            = static_cast<Scalar>(timestamp - lowerTimestamp)
+							/ static_cast<Scalar>(upperTimestamp - lowerTimestamp);
+		return interpolateComponentwise(translationAt(upper - 1), rotationAt(upper - 1), translationAt(upper),
+			rotationAt(upper), timestamp, lambda);
 	}
 
-private:
 	/**
 	 * Perform linear interpolation between two transformations.
-	 * @param T_a First transformation.
-	 * @param T_b Second transformation.
+	 * @param t_a First transformation translation.
+	 * @param q_a First transformation rotation.
+	 * @param t_b Second transformation translation.
+	 * @param q_b Second transformation rotation.
 	 * @param timestamp Interpolated transformation timestamp.
 	 * @param lambda Distance point between the two transformation to interpolate.
 	 * @return Interpolated transformation.
 	 */
-	static TransformationType interpolateComponentwise(
-		const TransformationType &T_a, const TransformationType &T_b, const int64_t timestamp, Scalar lambda) {
+	static TransformationType interpolateComponentwise(const Vector3 &t_a, const Quaternion &q_a, const Vector3 &t_b,
+		const Quaternion &q_b, const int64_t timestamp, Scalar lambda) {
 		dv::runtime_assert(
 			lambda >= static_cast<Scalar>(0.) && lambda <= static_cast<Scalar>(1.), "lambda value is out of bounds");
-		const auto t                            = T_a.getTranslation();
-		const Eigen::Matrix<Scalar, 3, 1> t_int = t + lambda * (T_b.getTranslation() - t);
-		const Eigen::Quaternion<Scalar> q_int   = T_a.getQuaternion().slerp(lambda, T_b.getQuaternion());
+		const Vector3 t_int    = t_a + lambda * (t_b - t_a);
+		const Quaternion q_int = q_a.slerp(lambda, q_b);
 
 		return TransformationType(timestamp, t_int, q_int);
 	}
 
 	/**
-	 * Finds the lower bound iterator in the buffer.
+	 * Finds the lower bound in the given logical index range. The search starts at the position of the previous
+	 * lookup and scans a few transformations forward before falling back to binary search.
 	 * @see std::lower_bound
-	 * @param t Unix timestamp in microseconds to search for.
-	 * @return Iterator to the buffer with timestamp that is *equal or not less* than given timestamp.
-	 */
-	[[nodiscard]] inline typename TransformationBuffer::const_iterator bufferLowerBound(int64_t t) const {
-		return std::lower_bound(
-			mTransforms.begin(), mTransforms.end(), t, [](const TransformationType &st, int64_t ts) {
-				return st.getTimestamp() < ts;
-			});
-	}
-
-	/**
-	 * Finds the upper bound iterator in the buffer.
-	 * @see std::upper_bound
-	 * @param t Unix timestamp in microseconds to search for.
-	 * @return Iterator to the buffer with timestamp that is *greater* than given timestamp or `end` if not available.
+	 * @param first First logical index of the searched range.
+	 * @param last Logical index past the end of the searched range.
+	 * @param timestamp Unix timestamp in microseconds to search for.
+	 * @return Logical index of the first transformation with timestamp *equal or not less* than given timestamp, or
+	 * `last` if not available.
 	 */
-	[[nodiscard]] inline typename TransformationBuffer::const_iterator bufferUpperBound(int64_t t) const {
-		return std::upper_bound(
-			mTransforms.begin(), mTransforms.end(), t, [](int64_t ts, const TransformationType &st) {
-				return ts < st.getTimestamp();
-			});
+	[[nodiscard]] size_t lowerBound(size_t first, size_t last, const int64_t timestamp) const {
+		const uint64_t sequence = mCursor.sequence.load(std::memory_order_relaxed);
+		if (sequence >= mDropped && sequence - mDropped < last) {
+			auto index = static_cast<size_t>(sequence - mDropped);
+			if (index >= first && (index == first || timestampAt(index - 1) < timestamp)) {
+				const size_t scanEnd = std::min(index + CursorScanLength, last);
+				for (; index < scanEnd; index++) {
+					if (timestampAt(index) >= timestamp) {
+						mCursor.sequence.store(mDropped + index, std::memory_order_relaxed);
+						return index;
+					}
+				}
+				first = index;
+			}
+		}
+
+		size_t count = last - first;
+		while (count > 0) {
+			const size_t step = count / 2;
+			if (timestampAt(first + step) < timestamp) {
+				first += step + 1;
+				count -= step + 1;
+			}
+			else {
+				count = step;
+			}
+		}
+
+		mCursor.sequence.store(mDropped + first, std::memory_order_relaxed);
+		return first;
 	}
 };
 
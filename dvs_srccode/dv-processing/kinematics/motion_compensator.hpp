@@ -7,6 +7,8 @@
 #include "linear_transformer.hpp"
 #include "pixel_motion_predictor.hpp"
 
+#include <array>
+
 namespace dv::kinematics {
 
 template<class Accumulator = dv::EdgeMapAccumulator, class PixelPredictor = kinematics::PixelMotionPredictor>
@@ -231,15 +233,73 @@ private:
 		const int64_t transformationsFrom     = from - transExtraTime;
 		const int64_t transformationsTo       = to + transExtraTime;
 
-		// Slice the exact period
-		auto slicedTransforms = transformer.getTransformsBetween(transformationsFrom, transformationsTo);
+		// Slice the exact period without copying and densify using resampling by interpolation
+		return transformer.viewBetween(transformationsFrom, transformationsTo).resampleTransforms(samplingPeriod);
+	}
+
+	/**
+	 * Number of events warped together with the same homography.
+	 */
+	static constexpr size_t warpBatchSize = 64;
+
+	/**
+	 * Coordinates of consecutive events that share the same camera motion.
+	 */
+	struct WarpBatch {
+		std::array<float, warpBatchSize> x;
+		std::array<float, warpBatchSize> y;
+		std::array<const dv::Event *, warpBatchSize> events;
+		size_t size = 0;
+	};
+
+	/**
+	 * Warp a batch of events using a homography and append the events that land within the camera dimensions
+	 * to the output. The projection loop is branch-free over contiguous arrays, so it is vectorized by the compiler.
+	 * @param batch 		Events to be warped, the batch is emptied.
+	 * @param H 			Pixel plane homography.
+	 * @param output 		Output event buffer.
+	 */
+	void flushWarpBatch(WarpBatch &batch, const Eigen::Matrix3f &H, dv::cvector<dv::Event> &output) const {
+		std::array<float, warpBatchSize> u;
+		std::array<float, warpBatchSize> v;
+
+		for (size_t i = 0; i < batch.size; i++) {
+			const float w = H(2, 0) * batch.x[i] + H(2, 1) * batch.y[i] + H(2, 2);
+			u[i]          = (H(0, 0) * batch.x[i] + H(0, 1) * batch.y[i] + H(0, 2)) / w;
+			v[i]          = (H(1, 0) * batch.x[i] + H(1, 1) * batch.y[i] + H(1, 2)) / w;
+		}
+
+		const auto &camera = predictor.getCameraGeometry();
+		for (size_t i = 0; i < batch.size; i++) {
+			if (camera->isWithinDimensions(cv::Point2f(u[i], v[i]))) {
+				const auto *event = batch.events[i];
+				output.emplace_back(event->timestamp(), static_cast<int16_t>(u[i]), static_cast<int16_t>(v[i]),
+					event->polarity());
+			}
+		}
 
-		// Densify using resampling by interpolation
-		return slicedTransforms.resampleTransforms(samplingPeriod);
+		batch.size = 0;
 	}
 
+	/**
+	 * Whether the pixel predictor provides the pixel plane homography and camera geometry needed by the single
+	 * pass compensation kernel.
+	 */
+	static constexpr bool predictorSupportsHomography
+		= requires(const PixelPredictor &p, const dv::kinematics::Transformationf &dT) {
+			  { p.getHomography(dT, 1.f) } -> std::convertible_to<Eigen::Matrix3f>;
+			  { p.getCameraGeometry() } -> std::convertible_to<camera::CameraGeometry::SharedPtr>;
+			  { p.isUseDistortion() } -> std::convertible_to<bool>;
+		  };
+
 	/**
 	 * Apply motion compensation to event store and project all event into the target transformation.
+	 *
+	 * Events are processed in a single pass, advancing through the resampled transformations in lockstep with
+	 * event timestamps. Each event is warped with the motion of the transformation preceding it, the motion is
+	 * converted into a pixel homography once per transformation interval and events are warped in batches into a
+	 * single preallocated output buffer. If the predictor uses a distortion model, which a homography can't
+	 * represent, events are predicted one by one within the same pass.
 	 * @param events 		Input events.
 	 * @param transforms 	Transformer containing the fine grained trajectory of the camera motion.
 	 * @param target 		Target position of the camera to be projected into.
@@ -248,16 +308,98 @@ private:
 	 */
 	[[nodiscard]] dv::EventStore compensateEvents(const dv::EventStore &events,
 		const dv::kinematics::LinearTransformerf &transforms, const dv::kinematics::Transformationf &target,
-		const float depth) {
-		dv::EventStore compensated;
-		auto prev  = transforms.cbegin();
-		auto T_CW1 = target.inverse().getTransform();
-		for (auto next = transforms.cbegin() + 1; next != transforms.cend(); next++, prev++) {
-			dv::EventStore thinSlice = events.sliceTime(prev->getTimestamp() + 1, next->getTimestamp() + 1);
-			auto deltaT              = dv::kinematics::Transformationf(0, T_CW1 * prev->getTransform());
-			compensated.add(predictor.predictEvents(thinSlice, deltaT, depth));
+		const float depth) const {
+		const auto T_CW1 = target.inverse().getTransform();
+
+		if constexpr (!predictorSupportsHomography) {
+			// Generic predictors only provide event store prediction, compensate each transformation interval
+			dv::EventStore compensated;
+			auto prev = transforms.cbegin();
+			for (auto next = transforms.cbegin() + 1; next != transforms.cend(); next++, prev++) {
+				dv::EventStore thinSlice = events.sliceTime(prev->getTimestamp() + 1, next->getTimestamp() + 1);
+				auto deltaT              = dv::kinematics::Transformationf(0, T_CW1 * prev->getTransform());
+				compensated.add(predictor.predictEvents(thinSlice, deltaT, depth));
+			}
+			return compensated;
+		}
+		else {
+			if (events.isEmpty() || transforms.size() < 2) {
+				return {};
+			}
+
+			auto output = std::make_shared<dv::EventPacket>();
+			output->elements.reserve(events.size());
+
+			const bool useHomography = !predictor.isUseDistortion() && depth > 0.f;
+			const auto &camera       = predictor.getCameraGeometry();
+
+			auto prev                    = transforms.cbegin();
+			auto next                    = std::next(prev);
+			const int64_t firstTimestamp = prev.timestamp();
+			int64_t nextTimestamp        = next.timestamp();
+
+			// Motion of the current interval, computed lazily only for intervals that contain events
+			bool intervalReady = false;
+			dv::kinematics::Transformationf deltaT;
+			Eigen::Matrix3f H;
+
+			WarpBatch batch;
+
+			for (const auto &event : events) {
+				const int64_t timestamp = event.timestamp();
+
+				// Events up to and including the first transformation timestamp are not compensated
+				if (timestamp <= firstTimestamp) {
+					continue;
+				}
+
+				// Advance to the interval (prev, next] containing the event
+				while (next != transforms.cend() && timestamp > nextTimestamp) {
+					if (batch.size > 0) {
+						flushWarpBatch(batch, H, output->elements);
+					}
+					prev++;
+					next++;
+					nextTimestamp = next != transforms.cend() ? next.timestamp() : nextTimestamp;
+					intervalReady = false;
+				}
+
+				if (next == transforms.cend()) {
+					break;
+				}
+
+				if (!intervalReady) {
+					deltaT = dv::kinematics::Transformationf(0, T_CW1 * prev->getTransform());
+					if (useHomography) {
+						H = predictor.getHomography(deltaT, depth);
+					}
+					intervalReady = true;
+				}
+
+				if (useHomography) {
+					batch.x[batch.size]      = static_cast<float>(event.x());
+					batch.y[batch.size]      = static_cast<float>(event.y());
+					batch.events[batch.size] = &event;
+					batch.size++;
+					if (batch.size == warpBatchSize) {
+						flushWarpBatch(batch, H, output->elements);
+					}
+				}
+				else {
+					const auto out = predictor.template predict<cv::Point2f>(event, deltaT, depth);
+					if (camera->isWithinDimensions(out)) {
+						output->elements.emplace_back(
+							timestamp, static_cast<int16_t>(out.x), static_cast<int16_t>(out.y), event.polarity());
+					}
+				}
+			}
+
+			if (batch.size > 0) {
+				flushWarpBatch(batch, H, output->elements);
+			}
+
+			return dv::EventStore(std::shared_ptr<const dv::EventPacket>(std::move(output)));
 		}
-		return compensated;
 	}
 
 	/**
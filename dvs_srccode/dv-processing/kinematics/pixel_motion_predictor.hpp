@@ -88,6 +88,38 @@ public:
 		}
 	}
 
+	/**
+	 * Get a pixel plane homography which is equivalent to `predict` without the distortion model. The prediction
+	 * back-projects a pixel `x` onto a plane at `depth`, transforms and projects it back, which for a fronto-parallel
+	 * plane reduces to `H = K * (R + t * [0 0 1] / depth) * K^-1`. Applying the homography costs a single 3x3
+	 * matrix multiplication per pixel and allows warping batches of pixels with the same motion.
+	 * @param dT 		Camera motion transformation.
+	 * @param depth 	Scene depth, must be positive.
+	 * @return 			Homography mapping homogeneous pixel coordinates.
+	 */
+	[[nodiscard]] Eigen::Matrix3f getHomography(const Transformationf &dT, const float depth) const {
+		const auto focal   = camera->getFocalLength<cv::Point2f>();
+		const auto central = camera->getCentralPoint<cv::Point2f>();
+
+		Eigen::Matrix3f K;
+		K << focal.x, 0.f, central.x, 0.f, focal.y, central.y, 0.f, 0.f, 1.f;
+		Eigen::Matrix3f invK;
+		invK << 1.f / focal.x, 0.f, -central.x / focal.x, 0.f, 1.f / focal.y, -central.y / focal.y, 0.f, 0.f, 1.f;
+
+		Eigen::Matrix3f motion  = dT.getRotationMatrix();
+		motion.col(2)          += dT.getTranslation<Eigen::Vector3f>() / depth;
+
+		return K * motion * invK;
+	}
+
+	/**
+	 * Get the camera geometry used for the prediction.
+	 * @return 	Camera geometry instance.
+	 */
+	[[nodiscard]] const camera::CameraGeometry::SharedPtr &getCameraGeometry() const {
+		return camera;
+	}
+
 	/**
 	 * Is the distortion model enabled for the reprojection of coordinates.
 	 * @return 	True if the distortion model is enabled, false otherwise.
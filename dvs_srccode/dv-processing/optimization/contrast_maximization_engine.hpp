@@ -0,0 +1,794 @@
+#pragma once
+
+#include "../camera/camera_geometry.hpp"
+#include "../core/core.hpp"
+#include "../core/time.hpp"
+#include "../data/imu_base.hpp"
+#include "../imu/rotation-integrator.hpp"
+#include "../kinematics/transformation.hpp"
+#include "optimization_functor.hpp"
+
+#include <Eigen/Geometry>
+#include <opencv2/core.hpp>
+#include <unsupported/Eigen/NonLinearOptimization>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <vector>
+
+namespace dv::optimization {
+
+/**
+ * Warp model concept used by `ContrastMaximizationEngine`. A warp model holds per-event precomputed data and maps
+ * event at given index into a 3D point in the reference camera frame, together with the derivative of that point
+ * with respect to the model parameters.
+ */
+template<class Model>
+concept ContrastWarpModel = requires(const Model &model, const typename Model::Parameters &parameters,
+	const size_t index, Eigen::Vector3f &point, typename Model::PointJacobian &jacobian) {
+	{ Model::NumParameters } -> std::convertible_to<int>;
+	{ model.size() } -> std::convertible_to<size_t>;
+	model.warp(index, parameters, point, jacobian);
+};
+
+/**
+ * Constant velocity translation and constant scene depth warp model, equivalent to the motion model of
+ * `TranslationLossFunctor`. Parameters are (tx, ty, tz, depth): the camera translates linearly by (tx, ty, tz) between
+ * the lowest and the highest timestamp of the event chunk, events are warped to the highest timestamp.
+ */
+class TranslationAndDepthWarpModel {
+public:
+	static constexpr int NumParameters = 4;
+
+	using Parameters    = Eigen::Matrix<float, NumParameters, 1>;
+	using PointJacobian = Eigen::Matrix<float, 3, NumParameters>;
+
+	TranslationAndDepthWarpModel() = default;
+
+	/**
+	 * Construct the warp model and precompute the per-event data.
+	 * @param camera Camera geometry used to back project events.
+	 * @param events Events to be warped.
+	 */
+	TranslationAndDepthWarpModel(const dv::camera::CameraGeometry &camera, const dv::EventStore &events) {
+		update(camera, events);
+	}
+
+	/**
+	 * Replace the events of the model, internal buffers are reused.
+	 * @param camera Camera geometry used to back project events.
+	 * @param events Events to be warped.
+	 */
+	void update(const dv::camera::CameraGeometry &camera, const dv::EventStore &events) {
+		mRays.clear();
+		mTimeScales.clear();
+		mRays.reserve(events.size());
+		mTimeScales.reserve(events.size());
+
+		if (events.isEmpty()) {
+			return;
+		}
+
+		const int64_t lowestTime = events.getLowestTime();
+		const auto timeRange     = static_cast<float>(events.getHighestTime() - lowestTime);
+		for (const auto &event : events) {
+			mRays.push_back(camera.backProject<Eigen::Vector3f>(cv::Point2i(event.x(), event.y())));
+			// Translation at event time relative to the reference (highest) time: (alpha - 1) * t
+			const float alpha
+				= timeRange > 0.f ? static_cast<float>(event.timestamp() - lowestTime) / timeRange : 1.f;
+			mTimeScales.push_back(alpha - 1.f);
+		}
+	}
+
+	/**
+	 * Number of events in the model.
+	 */
+	[[nodiscard]] size_t size() const {
+		return mRays.size();
+	}
+
+	/**
+	 * Warp an event into the reference camera frame.
+	 * @param index Event index.
+	 * @param parameters Model parameters (tx, ty, tz, depth).
+	 * @param point Output warped 3D point.
+	 * @param jacobian Output derivative of the warped point with respect to the parameters.
+	 */
+	void warp(const size_t index, const Parameters &parameters, Eigen::Vector3f &point, PointJacobian &jacobian) const {
+		const Eigen::Vector3f &ray = mRays[index];
+		const float scale          = mTimeScales[index];
+		const bool depthValid      = parameters(3) > minimumDepth;
+
+		point = ray * (depthValid ? parameters(3) : minimumDepth) + scale * parameters.head<3>();
+		jacobian.leftCols<3>() = Eigen::Matrix3f::Identity() * scale;
+		jacobian.col(3)        = depthValid ? ray : Eigen::Vector3f::Zero();
+	}
+
+private:
+	static constexpr float minimumDepth = 1e-3f;
+
+	std::vector<Eigen::Vector3f> mRays;
+	std::vector<float> mTimeScales;
+};
+
+/**
+ * Pure rotation warp model with a constant gyroscope measurement offset, equivalent to the motion model of
+ * `RotationLossFunctor`. Parameters are the gyroscope offset (x, y, z) in the imu frame in radians per second.
+ *
+ * The imu is integrated only once, with zero offset, when the model is updated. The effect of the offset on the
+ * integrated rotation is applied as a first order correction, which is accurate as long as the offset multiplied by
+ * the chunk duration remains small. Events are warped to the highest timestamp of the event chunk.
+ */
+class RotationWarpModel {
+public:
+	static constexpr int NumParameters = 3;
+
+	using Parameters    = Eigen::Matrix<float, NumParameters, 1>;
+	using PointJacobian = Eigen::Matrix<float, 3, NumParameters>;
+
+	RotationWarpModel() = default;
+
+	/**
+	 * Construct the warp model and precompute the per-event data.
+	 * @param camera Camera geometry used to back project events.
+	 * @param events Events to be warped.
+	 * @param imuSamples Imu samples covering the time range of the events.
+	 * @param T_S_target Transformation from target (camera) to sensor (imu).
+	 * @param imuToCamTimeOffsetUs Time synchronization offset between imu and camera.
+	 */
+	RotationWarpModel(const dv::camera::CameraGeometry &camera, const dv::EventStore &events,
+		const dv::cvector<dv::IMU> &imuSamples, const dv::kinematics::Transformationf &T_S_target,
+		const int64_t imuToCamTimeOffsetUs) {
+		update(camera, events, imuSamples, T_S_target, imuToCamTimeOffsetUs);
+	}
+
+	/**
+	 * Replace the events and imu samples of the model, internal buffers are reused.
+	 * @param camera Camera geometry used to back project events.
+	 * @param events Events to be warped.
+	 * @param imuSamples Imu samples covering the time range of the events.
+	 * @param T_S_target Transformation from target (camera) to sensor (imu).
+	 * @param imuToCamTimeOffsetUs Time synchronization offset between imu and camera.
+	 */
+	void update(const dv::camera::CameraGeometry &camera, const dv::EventStore &events,
+		const dv::cvector<dv::IMU> &imuSamples, const dv::kinematics::Transformationf &T_S_target,
+		const int64_t imuToCamTimeOffsetUs) {
+		mRotatedRays.clear();
+		mOffsetJacobians.clear();
+
+		if (events.isEmpty()) {
+			return;
+		}
+
+		dv::imu::RotationIntegrator integrator(T_S_target, imuToCamTimeOffsetUs);
+		mTimestamps.clear();
+		mRotations.clear();
+		for (const auto &imu : imuSamples) {
+			integrator.accept(imu);
+			mTimestamps.push_back(integrator.getTimestamp());
+			mRotations.emplace_back(integrator.getRotation());
+		}
+
+		if (mTimestamps.empty() || events.getLowestTime() < mTimestamps.front()) {
+			throw dv::exceptions::InputError("Events timestamp smaller than smallest imu timestamp: rotation warp "
+											 "model will not be able to perform compensation");
+		}
+		if (events.getHighestTime() > mTimestamps.back()) {
+			throw dv::exceptions::InputError("Events timestamp bigger than biggest imu timestamp: rotation warp "
+											 "model will not be able to perform compensation");
+		}
+
+		mRotatedRays.reserve(events.size());
+		mOffsetJacobians.reserve(events.size());
+
+		// Offset in the imu frame expressed in the camera frame
+		const Eigen::Matrix3f R_S_target = T_S_target.getRotationMatrix();
+
+		size_t cursor                     = 0;
+		const int64_t referenceTime       = events.getHighestTime();
+		const Eigen::Matrix3f R_reference = interpolateRotation(referenceTime, cursor).transpose();
+		const float referenceDuration     = static_cast<float>(referenceTime - mTimestamps.front()) * 1e-6f;
+
+		cursor = 0;
+		for (const auto &event : events) {
+			const Eigen::Matrix3f warp = R_reference * interpolateRotation(event.timestamp(), cursor);
+			const float duration       = static_cast<float>(event.timestamp() - mTimestamps.front()) * 1e-6f;
+
+			mRotatedRays.push_back(warp * camera.backProject<Eigen::Vector3f>(cv::Point2i(event.x(), event.y())));
+			// First order effect of the offset on the relative rotation: R_ref(b)^T * R_k(b) ~= Exp(D_k * b) * R_ref^T * R_k
+			mOffsetJacobians.push_back(
+				(Eigen::Matrix3f::Identity() * referenceDuration - warp * duration) * R_S_target);
+		}
+	}
+
+	/**
+	 * Number of events in the model.
+	 */
+	[[nodiscard]] size_t size() const {
+		return mRotatedRays.size();
+	}
+
+	/**
+	 * Warp an event into the reference camera frame.
+	 * @param index Event index.
+	 * @param parameters Gyroscope offset in imu frame.
+	 * @param point Output warped 3D point.
+	 * @param jacobian Output derivative of the warped point with respect to the gyroscope offset.
+	 */
+	void warp(const size_t index, const Parameters &parameters, Eigen::Vector3f &point, PointJacobian &jacobian) const {
+		const Eigen::Matrix3f &offsetJacobian = mOffsetJacobians[index];
+		const Eigen::Vector3f rotationVector  = offsetJacobian * parameters;
+		const float angle                     = rotationVector.norm();
+
+		Eigen::Matrix3f skew = hat(rotationVector);
+		Eigen::Matrix3f leftJacobian;
+		if (angle < 1e-5f) {
+			point        = mRotatedRays[index] + rotationVector.cross(mRotatedRays[index]);
+			leftJacobian = Eigen::Matrix3f::Identity() + 0.5f * skew;
+		}
+		else {
+			point = Eigen::AngleAxisf(angle, rotationVector / angle) * mRotatedRays[index];
+			const float angleSquared = angle * angle;
+			leftJacobian             = Eigen::Matrix3f::Identity() + ((1.f - std::cos(angle)) / angleSquared) * skew
+						 + ((angle - std::sin(angle)) / (angleSquared * angle)) * skew * skew;
+		}
+
+		// d(Exp(phi) * y) / d(phi) = -[Exp(phi) * y]x * Jl(phi)
+		jacobian = -hat(point) * leftJacobian * offsetJacobian;
+	}
+
+private:
+	std::vector<Eigen::Vector3f> mRotatedRays;
+	std::vector<Eigen::Matrix3f> mOffsetJacobians;
+	std::vector<int64_t> mTimestamps;
+	std::vector<Eigen::Quaternionf> mRotations;
+
+	[[nodiscard]] static Eigen::Matrix3f hat(const Eigen::Vector3f &vector) {
+		Eigen::Matrix3f skew;
+		skew << 0.f, -vector.z(), vector.y(), vector.z(), 0.f, -vector.x(), -vector.y(), vector.x(), 0.f;
+		return skew;
+	}
+
+	/**
+	 * Interpolate the integrated camera rotation, the cursor is advanced monotonically for sorted timestamps.
+	 */
+	[[nodiscard]] Eigen::Matrix3f interpolateRotation(const int64_t timestamp, size_t &cursor) const {
+		while (cursor + 2 < mTimestamps.size() && mTimestamps[cursor + 1] <= timestamp) {
+			cursor++;
+		}
+		if (cursor + 1 >= mTimestamps.size() || mTimestamps[cursor + 1] == mTimestamps[cursor]) {
+			return mRotations[cursor].toRotationMatrix();
+		}
+
+		const float t = static_cast<float>(timestamp - mTimestamps[cursor])
+					  / static_cast<float>(mTimestamps[cursor + 1] - mTimestamps[cursor]);
+		return mRotations[cursor].slerp(std::clamp(t, 0.f, 1.f), mRotations[cursor + 1]).toRotationMatrix();
+	}
+};
+
+/**
+ * Contrast maximization with analytic gradients. Events are warped by a warp model and accumulated with bilinear
+ * voting into an image of warped events, the contrast is measured as the variance of this image. Since bilinear
+ * voting is piecewise differentiable, the exact gradient of the variance with respect to the warp parameters is:
+ *
+ * dVar / dp = 2 * contribution / numPixels * sum_k grad(I - mean)(x_k) * dx_k / dp
+ *
+ * where the image gradient is the gradient of the bilinear interpolant at the warped event location. The variance and
+ * its gradient are therefore computed at the cost of a single warp, compared to `NumParameters + 1` evaluations when
+ * using numerical differentiation with `ContrastMaximizationWrapper`.
+ *
+ * Per-event warp buffers and the image of warped events are kept across evaluations and optimizations. Warping runs
+ * in parallel over event stripes, accumulation runs in parallel over bands of image rows: warped events are sorted
+ * into the bands they vote into, so each band owns a disjoint part of a single image and no reduction is needed.
+ * The optimization reports the duration of each iteration.
+ * @tparam WarpModel Warp model, e.g. `RotationWarpModel` or `TranslationAndDepthWarpModel`.
+ */
+template<ContrastWarpModel WarpModel>
+class ContrastMaximizationEngine {
+public:
+	using Parameters = typename WarpModel::Parameters;
+
+	/**
+	 * Result of an optimization.
+	 */
+	struct Result {
+		/**
+		 * Optimized parameters.
+		 */
+		Parameters parameters;
+
+		/**
+		 * Variance of the image of warped events at optimized parameters.
+		 */
+		float variance = 0.f;
+
+		/**
+		 * Status of the Levenberg-Marquardt optimizer, see `Eigen::LevenbergMarquardtSpace::Status`.
+		 */
+		int status = 0;
+
+		/**
+		 * Number of performed iterations.
+		 */
+		int iterations = 0;
+
+		/**
+		 * Number of cost and gradient evaluations.
+		 */
+		int evaluations = 0;
+
+		/**
+		 * Wall clock duration of each iteration.
+		 */
+		std::vector<dv::Duration> iterationTimes;
+	};
+
+	/**
+	 * Construct a contrast maximization engine.
+	 * @param camera Camera geometry, used for projection of the warped events.
+	 * @param model Warp model.
+	 * @param contribution Contribution of each event to the image of warped events.
+	 * @param ftol Tolerance for the norm of the cost.
+	 * @param gtol Tolerance for the norm of the gradient of the cost.
+	 * @param xtol Tolerance for the norm of the solution vector.
+	 * @param maxfev Maximum number of cost function evaluations.
+	 */
+	ContrastMaximizationEngine(const dv::camera::CameraGeometry::SharedPtr &camera, WarpModel model,
+		const float contribution, const float ftol = 0.000345267f, const float gtol = 0.f,
+		const float xtol = 0.000345267f, const int maxfev = 400) :
+		mModel(std::move(model)),
+		mContribution(contribution),
+		mFtol(ftol),
+		mGtol(gtol),
+		mXtol(xtol),
+		mMaxfev(maxfev) {
+		if (camera == nullptr) {
+			throw dv::exceptions::NullPointer("Contrast maximization requires a valid camera geometry.");
+		}
+		if (contribution <= 0.f) {
+			throw dv::exceptions::InvalidArgument<float>("Event contribution must be positive.", contribution);
+		}
+
+		mResolution   = camera->getResolution();
+		mFocalLength  = camera->getFocalLength<cv::Point2f>();
+		mCentralPoint = camera->getCentralPoint<cv::Point2f>();
+		mImage        = cv::Mat(mResolution, CV_32FC1, cv::Scalar(0));
+
+		mStripes = static_cast<size_t>(std::clamp(cv::getNumThreads(), 1, 16));
+		mBands   = std::min(mStripes, static_cast<size_t>(mResolution.height));
+		mPartialGradients.resize(mStripes);
+		mPixelSums.resize(mBands);
+		mBandCounts.resize(mStripes * mBands);
+
+		mRowBands.resize(static_cast<size_t>(mResolution.height));
+		mTouchedRows.assign(static_cast<size_t>(mResolution.height), 0);
+		for (size_t band = 0; band < mBands; band++) {
+			const auto [begin, end] = partition(band, mBands, mRowBands.size());
+			std::fill(mRowBands.begin() + static_cast<std::ptrdiff_t>(begin),
+				mRowBands.begin() + static_cast<std::ptrdiff_t>(end), static_cast<uint32_t>(band));
+		}
+	}
+
+	/**
+	 * Access the warp model, e.g. to update it with a new chunk of events while keeping the buffers of the engine.
+	 * @return Reference to the warp model.
+	 */
+	[[nodiscard]] WarpModel &getModel() {
+		return mModel;
+	}
+
+	/**
+	 * Access the warp model.
+	 * @return Const reference to the warp model.
+	 */
+	[[nodiscard]] const WarpModel &getModel() const {
+		return mModel;
+	}
+
+	/**
+	 * Image of warped events from the last evaluation. The returned matrix shares the internal buffer of the engine
+	 * and is overwritten by the next evaluation.
+	 * @return Image of warped events.
+	 */
+	[[nodiscard]] const cv::Mat &getImage() const {
+		return mImage;
+	}
+
+	/**
+	 * Compute the variance of the image of warped events.
+	 * @param parameters Warp model parameters.
+	 * @return Variance of the image of warped events.
+	 */
+	[[nodiscard]] float evaluate(const Parameters &parameters) {
+		warpAndAccumulate(parameters);
+		return computeVariance();
+	}
+
+	/**
+	 * Compute the variance of the image of warped events and its gradient with respect to the parameters.
+	 * @param parameters Warp model parameters.
+	 * @param gradient Output gradient of the variance.
+	 * @return Variance of the image of warped events.
+	 */
+	[[nodiscard]] float evaluate(const Parameters &parameters, Parameters &gradient) {
+		warpAndAccumulate(parameters);
+		const float variance = computeVariance();
+		gradient             = computeGradient();
+		return variance;
+	}
+
+	/**
+	 * Maximize the contrast, starting from given initial parameters. The cost 1 / stddev is minimized with
+	 * Levenberg-Marquardt using the analytic Jacobian.
+	 * @param initialValues Initial parameters.
+	 * @return Optimization result.
+	 */
+	[[nodiscard]] Result optimize(const Parameters &initialValues) {
+		Result result;
+
+		if (mModel.size() == 0) {
+			result.parameters = initialValues;
+			result.status     = Eigen::LevenbergMarquardtSpace::ImproperInputParameters;
+			return result;
+		}
+
+		LossFunctor functor(*this);
+		Eigen::LevenbergMarquardt<LossFunctor, float> lm(functor);
+		lm.parameters.ftol   = mFtol;
+		lm.parameters.gtol   = mGtol;
+		lm.parameters.xtol   = mXtol;
+		lm.parameters.maxfev = mMaxfev;
+
+		Eigen::VectorXf variable = initialValues;
+		auto status              = lm.minimizeInit(variable);
+		if (status != Eigen::LevenbergMarquardtSpace::ImproperInputParameters) {
+			do {
+				const auto start = std::chrono::steady_clock::now();
+				status           = lm.minimizeOneStep(variable);
+				result.iterationTimes.push_back(
+					std::chrono::duration_cast<dv::Duration>(std::chrono::steady_clock::now() - start));
+			}
+			while (status == Eigen::LevenbergMarquardtSpace::Running);
+		}
+
+		result.parameters  = variable;
+		result.variance    = evaluate(result.parameters);
+		result.status      = status;
+		result.iterations  = static_cast<int>(lm.iter);
+		result.evaluations = functor.mEvaluations;
+		return result;
+	}
+
+private:
+	using PixelJacobian = Eigen::Matrix<float, 2, WarpModel::NumParameters>;
+
+	WarpModel mModel;
+	float mContribution;
+	float mFtol;
+	float mGtol;
+	float mXtol;
+	int mMaxfev;
+
+	cv::Size mResolution;
+	cv::Point2f mFocalLength;
+	cv::Point2f mCentralPoint;
+
+	// Minimal number of events per parallel stripe, smaller chunks are not worth the scheduling overhead
+	static constexpr size_t MinStripeEvents = 4096;
+
+	size_t mStripes;
+	size_t mBands;
+	cv::Mat mImage;
+	float mMean = 0.f;
+	std::vector<Eigen::Vector2f> mWarpedPoints;
+	std::vector<PixelJacobian> mWarpedJacobians;
+	std::vector<Parameters> mPartialGradients;
+	std::vector<std::pair<double, double>> mPixelSums;
+
+	// Row band of each image row, per stripe and band event counts and event indices sorted by row band
+	std::vector<uint32_t> mRowBands;
+	std::vector<size_t> mBandCounts;
+	std::vector<size_t> mBandOffsets;
+	std::vector<uint32_t> mBandEvents;
+
+	// Rows of the image of warped events that received votes in the last accumulation, other rows are zero
+	std::vector<uint8_t> mTouchedRows;
+
+	/**
+	 * Levenberg-Marquardt functor with analytic Jacobian, the last evaluation is cached since the optimizer
+	 * requests the Jacobian at the point it has just evaluated.
+	 */
+	class LossFunctor : public OptimizationFunctor<float> {
+	public:
+		explicit LossFunctor(ContrastMaximizationEngine &engine) :
+			OptimizationFunctor<float>(WarpModel::NumParameters, WarpModel::NumParameters),
+			mEngine(engine) {
+		}
+
+		int operator()(const Eigen::VectorXf &input, Eigen::VectorXf &cost) const {
+			evaluateCached(input);
+			cost.setZero();
+			cost(0) = 1.f / std::sqrt(mVariance);
+			return 0;
+		}
+
+		int df(const Eigen::VectorXf &input, Eigen::MatrixXf &jacobian) const {
+			evaluateCached(input);
+			jacobian.setZero();
+			// d(Var^-1/2) = -1/2 * Var^-3/2 * dVar
+			jacobian.row(0) = (-0.5f / (mVariance * std::sqrt(mVariance))) * mGradient.transpose();
+			return 0;
+		}
+
+		mutable int mEvaluations = 0;
+
+	private:
+		ContrastMaximizationEngine &mEngine;
+		mutable Parameters mParameters;
+		mutable Parameters mGradient;
+		mutable float mVariance = 0.f;
+		mutable bool mCached    = false;
+
+		void evaluateCached(const Eigen::VectorXf &input) const {
+			const Parameters parameters = input;
+			if (mCached && parameters == mParameters) {
+				return;
+			}
+			mVariance = std::max(mEngine.evaluate(parameters, mGradient), std::numeric_limits<float>::min());
+			mParameters = parameters;
+			mCached     = true;
+			mEvaluations++;
+		}
+	};
+
+	[[nodiscard]] static std::pair<size_t, size_t> partition(
+		const size_t part, const size_t parts, const size_t count) {
+		return {(part * count) / parts, ((part + 1) * count) / parts};
+	}
+
+	/**
+	 * Number of parallel event stripes for the given number of events.
+	 */
+	[[nodiscard]] size_t stripeCount(const size_t numEvents) const {
+		return std::clamp<size_t>(numEvents / MinStripeEvents, 1, mStripes);
+	}
+
+	/**
+	 * Row bands a warped point votes into, the point votes into its pixel row and the row below.
+	 * @return First and second band, the second one is equal to the first if the point votes into a single band,
+	 * 		   or the maximum value if it votes into no band.
+	 */
+	[[nodiscard]] std::pair<uint32_t, uint32_t> pointBands(const Eigen::Vector2f &point) const {
+		constexpr auto none = std::numeric_limits<uint32_t>::max();
+		const int y0        = static_cast<int>(std::floor(point.y()));
+		const uint32_t top  = y0 >= 0 ? mRowBands[static_cast<size_t>(y0)] : none;
+		const uint32_t bottom
+			= y0 + 1 < mResolution.height ? mRowBands[static_cast<size_t>(y0 + 1)] : none;
+		if (top == none) {
+			return {bottom, bottom};
+		}
+		return {top, bottom == none ? top : bottom};
+	}
+
+	/**
+	 * Warp all events, store the pixel coordinates and Jacobians, and accumulate them into the image of warped events.
+	 * Events are warped in parallel stripes, which also count the events per row band. The event indices are then
+	 * sorted by row band and each band accumulates its events into its own rows of the image.
+	 */
+	void warpAndAccumulate(const Parameters &parameters) {
+		const size_t numEvents = mModel.size();
+		const size_t stripes   = stripeCount(numEvents);
+		mWarpedPoints.resize(numEvents);
+		mWarpedJacobians.resize(numEvents);
+		std::fill(mBandCounts.begin(), mBandCounts.end(), 0);
+
+		cv::parallel_for_(cv::Range(0, static_cast<int>(stripes)), [&](const cv::Range &range) {
+			Eigen::Vector3f point;
+			typename WarpModel::PointJacobian pointJacobian;
+			Eigen::Matrix<float, 2, 3> projectionJacobian;
+
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				auto *counts            = mBandCounts.data() + static_cast<size_t>(stripe) * mBands;
+				const auto [begin, end] = partition(static_cast<size_t>(stripe), stripes, numEvents);
+				for (size_t i = begin; i < end; i++) {
+					mModel.warp(i, parameters, point, pointJacobian);
+					if (point.z() <= 0.f) {
+						mWarpedPoints[i].x() = std::numeric_limits<float>::quiet_NaN();
+						continue;
+					}
+
+					const float inverseDepth = 1.f / point.z();
+					const float u            = mFocalLength.x * point.x() * inverseDepth + mCentralPoint.x;
+					const float v            = mFocalLength.y * point.y() * inverseDepth + mCentralPoint.y;
+					if (!(u > -1.f && v > -1.f && u < static_cast<float>(mResolution.width)
+							&& v < static_cast<float>(mResolution.height))) {
+						mWarpedPoints[i].x() = std::numeric_limits<float>::quiet_NaN();
+						continue;
+					}
+
+					projectionJacobian << mFocalLength.x * inverseDepth, 0.f,
+						-mFocalLength.x * point.x() * inverseDepth * inverseDepth, 0.f, mFocalLength.y * inverseDepth,
+						-mFocalLength.y * point.y() * inverseDepth * inverseDepth;
+					mWarpedPoints[i]    = Eigen::Vector2f(u, v);
+					mWarpedJacobians[i] = projectionJacobian * pointJacobian;
+
+					const auto [first, second] = pointBands(mWarpedPoints[i]);
+					counts[first]++;
+					if (second != first) {
+						counts[second]++;
+					}
+				}
+			}
+		});
+
+		// Offsets of each stripe within each band, bands are stored contiguously in the order of the stripes, so
+		// events within a band stay in their original order
+		mBandOffsets.resize(mBands * stripes + 1);
+		size_t offset = 0;
+		for (size_t band = 0; band < mBands; band++) {
+			for (size_t stripe = 0; stripe < stripes; stripe++) {
+				mBandOffsets[band * stripes + stripe] = offset;
+				offset                                += mBandCounts[stripe * mBands + band];
+			}
+		}
+		mBandOffsets.back() = offset;
+		mBandEvents.resize(offset);
+
+		cv::parallel_for_(cv::Range(0, static_cast<int>(stripes)), [&](const cv::Range &range) {
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				const auto [begin, end] = partition(static_cast<size_t>(stripe), stripes, numEvents);
+				for (size_t i = begin; i < end; i++) {
+					if (std::isnan(mWarpedPoints[i].x())) {
+						continue;
+					}
+					const auto [first, second] = pointBands(mWarpedPoints[i]);
+					const auto index = static_cast<uint32_t>(i);
+					mBandEvents[mBandOffsets[first * stripes + static_cast<size_t>(stripe)]++] = index;
+					if (second != first) {
+						mBandEvents[mBandOffsets[second * stripes + static_cast<size_t>(stripe)]++] = index;
+					}
+				}
+			}
+		});
+
+		cv::parallel_for_(cv::Range(0, static_cast<int>(mBands)), [&](const cv::Range &range) {
+			for (int band = range.start; band < range.end; band++) {
+				// After the scatter, the offset of the last stripe of the previous band is the start of this band
+				const size_t eventsBegin
+					= band == 0 ? 0 : mBandOffsets[static_cast<size_t>(band) * stripes - 1];
+				const size_t eventsEnd = mBandOffsets[(static_cast<size_t>(band) + 1) * stripes - 1];
+				const auto [rowBegin, rowEnd]
+					= partition(static_cast<size_t>(band), mBands, static_cast<size_t>(mResolution.height));
+				const int firstRow = static_cast<int>(rowBegin);
+				const int lastRow  = static_cast<int>(rowEnd);
+
+				// Only rows that received votes in the previous accumulation have to be cleared
+				for (int row = firstRow; row < lastRow; row++) {
+					if (mTouchedRows[static_cast<size_t>(row)] != 0) {
+						auto *values = mImage.ptr<float>(row);
+						std::fill(values, values + mResolution.width, 0.f);
+						mTouchedRows[static_cast<size_t>(row)] = 0;
+					}
+				}
+
+				for (size_t e = eventsBegin; e < eventsEnd; e++) {
+					const Eigen::Vector2f &point = mWarpedPoints[mBandEvents[e]];
+
+					const int x0  = static_cast<int>(std::floor(point.x()));
+					const int y0  = static_cast<int>(std::floor(point.y()));
+					const float a = point.x() - static_cast<float>(x0);
+					const float b = point.y() - static_cast<float>(y0);
+					if (y0 >= firstRow) {
+						vote(x0, y0, (1.f - a) * (1.f - b));
+						vote(x0 + 1, y0, a * (1.f - b));
+					}
+					if (y0 + 1 < lastRow) {
+						vote(x0, y0 + 1, (1.f - a) * b);
+						vote(x0 + 1, y0 + 1, a * b);
+					}
+				}
+
+				double sum        = 0.0;
+				double squaredSum = 0.0;
+				for (int row = firstRow; row < lastRow; row++) {
+					if (mTouchedRows[static_cast<size_t>(row)] == 0) {
+						continue;
+					}
+					const auto *values = mImage.ptr<float>(row);
+					for (int col = 0; col < mResolution.width; col++) {
+						sum        += values[col];
+						squaredSum += static_cast<double>(values[col]) * values[col];
+					}
+				}
+				mPixelSums[static_cast<size_t>(band)] = {sum, squaredSum};
+			}
+		});
+	}
+
+	/**
+	 * Add a weighted vote into a pixel of the image of warped events, pixels outside of the image are skipped. The
+	 * row must be owned by the calling band.
+	 */
+	void vote(const int x, const int y, const float weight) {
+		if (x >= 0 && y >= 0 && x < mResolution.width && y < mResolution.height) {
+			mImage.ptr<float>(y)[x]              += weight * mContribution;
+			mTouchedRows[static_cast<size_t>(y)] = 1;
+		}
+	}
+
+	/**
+	 * Compute the variance of the image of warped events from the per-band pixel sums of the last accumulation.
+	 */
+	[[nodiscard]] float computeVariance() {
+		const auto numPixels = static_cast<size_t>(mResolution.area());
+
+		double sum        = 0.0;
+		double squaredSum = 0.0;
+		for (const auto &[bandSum, bandSquaredSum] : mPixelSums) {
+			sum        += bandSum;
+			squaredSum += bandSquaredSum;
+		}
+
+		const double mean = sum / static_cast<double>(numPixels);
+		mMean             = static_cast<float>(mean);
+		return static_cast<float>(std::max(squaredSum / static_cast<double>(numPixels) - mean * mean, 0.0));
+	}
+
+	/**
+	 * Centered image value, pixels outside of the image do not contribute to the variance.
+	 */
+	[[nodiscard]] float centeredValue(const float *image, const int x, const int y) const {
+		if (x >= 0 && y >= 0 && x < mResolution.width && y < mResolution.height) {
+			return image[y * mResolution.width + x] - mMean;
+		}
+		return 0.f;
+	}
+
+	/**
+	 * Compute the gradient of the variance from the warped points of the last accumulation.
+	 */
+	[[nodiscard]] Parameters computeGradient() {
+		const size_t numEvents = mWarpedPoints.size();
+		const size_t stripes   = stripeCount(numEvents);
+		const auto *image      = mImage.ptr<float>();
+
+		std::fill(mPartialGradients.begin(), mPartialGradients.end(), Parameters::Zero());
+		cv::parallel_for_(cv::Range(0, static_cast<int>(stripes)), [&](const cv::Range &range) {
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				Parameters gradient     = Parameters::Zero();
+				const auto [begin, end] = partition(static_cast<size_t>(stripe), stripes, numEvents);
+				for (size_t i = begin; i < end; i++) {
+					const Eigen::Vector2f &point = mWarpedPoints[i];
+					if (std::isnan(point.x())) {
+						continue;
+					}
+
+					const int x0   = static_cast<int>(std::floor(point.x()));
+					const int y0   = static_cast<int>(std::floor(point.y()));
+					const float a  = point.x() - static_cast<float>(x0);
+					const float b  = point.y() - static_cast<float>(y0);
+					const float c00 = centeredValue(image, x0, y0);
+					const float c10 = centeredValue(image, x0 + 1, y0);
+					const float c01 = centeredValue(image, x0, y0 + 1);
+					const float c11 = centeredValue(image, x0 + 1, y0 + 1);
+
+					const Eigen::RowVector2f imageGradient(
+						(1.f - b) * (c10 - c00) + b * (c11 - c01), (1.f - a) * (c01 - c00) + a * (c11 - c10));
+					gradient += (imageGradient * mWarpedJacobians[i]).transpose();
+				}
+				mPartialGradients[static_cast<size_t>(stripe)] = gradient;
+			}
+		});
+
+		Parameters gradient = Parameters::Zero();
+		for (const auto &partial : mPartialGradients) {
+			gradient += partial;
+		}
+		return gradient * (2.f * mContribution / static_cast<float>(mResolution.area()));
+	}
+};
+
+} // namespace dv::optimization
@@ -9,6 +9,8 @@
 #include "../kinematics/motion_compensator.hpp"
 #include "../optimization/optimization_functor.hpp"
 
+#include <optional>
+
 namespace dv::optimization {
 
 /**
@@ -60,6 +62,17 @@ private:
 	 */
 	int64_t mImuToTargetTimeOffsetUs;
 
+	/**
+	 * Optional pre-integration of the imu data around a linearization offset, see `enablePreintegration()`.
+	 */
+	std::optional<dv::imu::RotationIntegrator::Preintegration> mPreintegration = std::nullopt;
+
+	/**
+	 * Maximum distance [radians] of an evaluated gyroscope offset from the linearization offset, up to which the
+	 * pre-integrated rotations are used.
+	 */
+	float mMaxOffsetDeviation = 0.f;
+
 public:
 	/**
 	 * This contrast maximization class assumes pure camera rotational motion model. Given a set of imu samples and
@@ -101,6 +114,35 @@ public:
 		}
 	}
 
+	/**
+	 * Pre-integrate the imu data once around the given gyroscope offset. Cost evaluations with an offset within
+	 * `maxOffsetDeviation` of the linearization offset then obtain the rotations through first order offset
+	 * Jacobians instead of re-integrating the samples, evaluations further away integrate the samples exactly.
+	 * The approximation error grows with the offset deviation multiplied by the duration of the imu data, so the
+	 * linearization offset should be close to the expected solution, e.g. the initial value of the optimization.
+	 * Pre-integration uses the exponential map for the sample rotations, results can differ slightly from the
+	 * exact integration. By default pre-integration is disabled and every evaluation integrates the samples.
+	 * @param linearizationOffset Gyroscope offset [radians] around which the imu data is pre-integrated.
+	 * @param maxOffsetDeviation Maximum distance [radians] of an evaluated offset from the linearization offset
+	 * up to which the pre-integrated rotations are used.
+	 */
+	void enablePreintegration(const Eigen::Vector3f &linearizationOffset, const float maxOffsetDeviation = 0.01f) {
+		if (maxOffsetDeviation < 0.f) {
+			throw dv::exceptions::InvalidArgument<float>(
+				"Maximum gyroscope offset deviation must be non-negative.", maxOffsetDeviation);
+		}
+		mPreintegration = dv::imu::RotationIntegrator(mT_S_target, mImuToTargetTimeOffsetUs, linearizationOffset)
+							  .preintegrate(mImuSamples);
+		mMaxOffsetDeviation = maxOffsetDeviation;
+	}
+
+	/**
+	 * Disable pre-integration, every cost evaluation integrates the imu samples exactly.
+	 */
+	void disablePreintegration() {
+		mPreintegration.reset();
+	}
+
 	/**
 	 * Implementation of the objective function: optimize gyroscope offset.
 	 * Current cost is stored in stdInverse. Notice that since we want to maximize the contrast
@@ -116,13 +158,24 @@ public:
 		Eigen::Vector3f gyroscopeOffsetImuFloat;
 		gyroscopeOffsetImuFloat << static_cast<float>(gyroscopeOffsetImu.x()),
 			static_cast<float>(gyroscopeOffsetImu.y()), static_cast<float>(gyroscopeOffsetImu.z());
-		dv::imu::RotationIntegrator rotationIntegrator(mT_S_target, mImuToTargetTimeOffsetUs, gyroscopeOffsetImuFloat);
 
-		// integrate imu & feed transformations to motion compensator
-		for (const auto &imu : mImuSamples) {
-			rotationIntegrator.accept(imu);
-			auto transform = rotationIntegrator.getTransformation();
-			mc->accept(transform);
+		if (mPreintegration.has_value()
+			&& (gyroscopeOffsetImuFloat - mPreintegration->gyroscopeOffset).norm() <= mMaxOffsetDeviation) {
+			// apply gyroscope offset to pre-integrated rotations & feed transformations to motion compensator
+			for (size_t i = 0; i < mPreintegration->size(); i++) {
+				mc->accept(mPreintegration->getTransformation(i, gyroscopeOffsetImuFloat));
+			}
+		}
+		else {
+			dv::imu::RotationIntegrator rotationIntegrator(
+				mT_S_target, mImuToTargetTimeOffsetUs, gyroscopeOffsetImuFloat);
+
+			// integrate imu & feed transformations to motion compensator
+			for (const auto &imu : mImuSamples) {
+				rotationIntegrator.accept(imu);
+				auto transform = rotationIntegrator.getTransformation();
+				mc->accept(transform);
+			}
 		}
 
 		// warp events and generate event image after warping
@@ -3,14 +3,59 @@
 //
 #pragma once
 #include "../core/concepts.hpp"
+#include "../core/thread_pool.hpp"
 #include "../optimization/optimization_functor.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
 #include <memory>
+#include <random>
+#include <vector>
 #include <unsupported/Eigen/NonLinearOptimization>
 #include <unsupported/Eigen/NumericalDiff>
 
 namespace dv::optimization {
 
+/**
+ * Lightweight non-owning reference to a functor, it is passed to the numerical differentiation instead of the functor
+ * itself, so concurrent optimizations share the functor (and its event and imu data) instead of copying it.
+ * @tparam Functor Referenced functor type.
+ */
+template<class Functor>
+class FunctorReference {
+public:
+	typedef typename Functor::Scalar Scalar;
+
+	enum {
+		InputsAtCompileTime = Functor::InputsAtCompileTime,
+		ValuesAtCompileTime = Functor::ValuesAtCompileTime
+	};
+
+	typedef typename Functor::InputType InputType;
+	typedef typename Functor::ValueType ValueType;
+	typedef typename Functor::JacobianType JacobianType;
+
+	explicit FunctorReference(const Functor &functor) : mFunctor(&functor) {
+	}
+
+	int operator()(const Eigen::VectorXf &input, Eigen::VectorXf &cost) const {
+		return (*mFunctor)(input, cost);
+	}
+
+	[[nodiscard]] int inputs() const {
+		return mFunctor->inputs();
+	}
+
+	[[nodiscard]] int values() const {
+		return mFunctor->values();
+	}
+
+private:
+	const Functor *mFunctor;
+};
+
 /**
  * Wrapper for all contrast maximization algorithms. For more information about contrast maximization please check
  * "contrast_maximization_rotation.hpp" or "contrast_maximization_translation_and_depth.hpp".
@@ -35,6 +80,7 @@ class ContrastMaximizationWrapper {
 		[[maybe_unused]] int optimizationSuccessful;
 		int iter;
 		Eigen::VectorXf optimizedVariable;
+		float cost = std::numeric_limits<float>::infinity();
 	};
 
 private:
@@ -73,10 +119,11 @@ public:
 	 * @param initialValues Initial values of variables to be optimized.
 	 * @return optimized variable that minimize cost.
 	 */
-	[[nodiscard]] optimizationOutput optimize(const Eigen::VectorXf &initialValues) {
+	[[nodiscard]] optimizationOutput optimize(const Eigen::VectorXf &initialValues) const {
 		Eigen::VectorXf optimizedVariable = initialValues;
-		Eigen::NumericalDiff<Functor> numDiff(*mFunctor, mParams.learningRate);
-		Eigen::LevenbergMarquardt<Eigen::NumericalDiff<Functor>, float> lm(numDiff);
+		Eigen::NumericalDiff<FunctorReference<Functor>> numDiff(
+			FunctorReference<Functor>(*mFunctor), mParams.learningRate);
+		Eigen::LevenbergMarquardt<Eigen::NumericalDiff<FunctorReference<Functor>>, float> lm(numDiff);
 		lm.parameters.epsfcn = mParams.epsfcn;
 		lm.parameters.ftol   = mParams.ftol;
 		lm.parameters.gtol   = mParams.gtol;
@@ -88,9 +135,179 @@ public:
 		output.iter                   = lm.iter;
 		output.optimizationSuccessful = ret;
 		output.optimizedVariable      = optimizedVariable;
+		// The solver keeps the residual of the accepted solution, no additional functor evaluation is needed
+		output.cost = lm.nfev > 0 ? finiteCost(lm.fvec.norm()) : std::numeric_limits<float>::infinity();
 
 		return output;
 	}
+
+	/**
+	 * Multi-hypothesis optimization: the cost of all initial hypotheses is evaluated concurrently on the thread pool,
+	 * afterwards the `numRefined` hypotheses with the lowest cost are refined concurrently with Levenberg-Marquardt.
+	 * The refined solution with the lowest cost is returned. All tasks share the functor, event and imu data are not
+	 * copied. The amount of work is bounded by the number of hypotheses, `numRefined` and the maximum number of
+	 * function evaluations of each refinement.
+	 *
+	 * This call blocks until all tasks are completed, it must not be called from a task running on the same pool.
+	 * @param hypotheses Initial values of variables to be optimized, see `gridHypotheses()` and
+	 * `randomHypotheses()`.
+	 * @param numRefined Number of best hypotheses that are refined with local optimization.
+	 * @param pool Thread pool executing the evaluations and refinements.
+	 * @return Refined solution with the lowest cost.
+	 */
+	[[nodiscard]] optimizationOutput optimize(const std::vector<Eigen::VectorXf> &hypotheses, const size_t numRefined,
+		const std::shared_ptr<dv::ThreadPool> &pool = dv::ThreadPool::global()) const {
+		if (hypotheses.empty()) {
+			throw dv::exceptions::InvalidArgument<size_t>(
+				"Multi-hypothesis optimization requires at least one hypothesis.", hypotheses.size());
+		}
+		if (numRefined == 0) {
+			throw dv::exceptions::InvalidArgument<size_t>(
+				"Multi-hypothesis optimization requires at least one hypothesis to refine.", numRefined);
+		}
+		if (pool == nullptr) {
+			throw dv::exceptions::NullPointer("Multi-hypothesis optimization requires a valid thread pool.");
+		}
+
+		std::vector<std::future<float>> costFutures;
+		costFutures.reserve(hypotheses.size());
+		for (const auto &hypothesis : hypotheses) {
+			costFutures.push_back(pool->submit([this, &hypothesis] {
+				return evaluateCost(hypothesis);
+			}));
+		}
+		const auto costs = collect(costFutures);
+
+		std::vector<size_t> order(hypotheses.size());
+		for (size_t i = 0; i < order.size(); i++) {
+			order[i] = i;
+		}
+		const size_t refined = std::min(numRefined, order.size());
+		std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(refined), order.end(),
+			[&costs](const size_t a, const size_t b) {
+				return costs[a] < costs[b] || (costs[a] == costs[b] && a < b);
+			});
+
+		std::vector<std::future<optimizationOutput>> refineFutures;
+		refineFutures.reserve(refined);
+		for (size_t i = 0; i < refined; i++) {
+			refineFutures.push_back(pool->submit([this, &hypothesis = hypotheses[order[i]]] {
+				return optimize(hypothesis);
+			}));
+		}
+		auto outputs = collect(refineFutures);
+
+		return *std::min_element(outputs.begin(), outputs.end(), [](const auto &a, const auto &b) {
+			return a.cost < b.cost;
+		});
+	}
+
+	/**
+	 * Generate hypotheses on a regular grid.
+	 * @param lower Lower bound of each variable.
+	 * @param upper Upper bound of each variable.
+	 * @param steps Number of grid steps for each variable, a variable with a single step is set to the middle of its
+	 * range.
+	 * @return Grid of hypotheses.
+	 */
+	[[nodiscard]] static std::vector<Eigen::VectorXf> gridHypotheses(
+		const Eigen::VectorXf &lower, const Eigen::VectorXf &upper, const Eigen::VectorXi &steps) {
+		if (lower.size() != upper.size() || lower.size() != steps.size()) {
+			throw dv::exceptions::InvalidArgument<Eigen::Index>(
+				"Grid bounds and steps must have the same dimensions.", steps.size());
+		}
+		if (steps.size() == 0 || steps.minCoeff() < 1) {
+			throw dv::exceptions::InvalidArgument<int>(
+				"Grid requires at least one step in each dimension.", steps.size() == 0 ? 0 : steps.minCoeff());
+		}
+
+		size_t total = 1;
+		for (Eigen::Index d = 0; d < steps.size(); d++) {
+			total *= static_cast<size_t>(steps(d));
+		}
+
+		std::vector<Eigen::VectorXf> hypotheses;
+		hypotheses.reserve(total);
+		for (size_t index = 0; index < total; index++) {
+			Eigen::VectorXf hypothesis(lower.size());
+			size_t remainder = index;
+			for (Eigen::Index d = 0; d < steps.size(); d++) {
+				const auto count = static_cast<size_t>(steps(d));
+				const size_t i   = remainder % count;
+				remainder        /= count;
+				hypothesis(d)    = count == 1 ? 0.5f * (lower(d) + upper(d))
+											  : lower(d)
+										 + (upper(d) - lower(d)) * static_cast<float>(i)
+											   / static_cast<float>(count - 1);
+			}
+			hypotheses.push_back(std::move(hypothesis));
+		}
+		return hypotheses;
+	}
+
+	/**
+	 * Generate hypotheses uniformly distributed within given bounds.
+	 * @param lower Lower bound of each variable.
+	 * @param upper Upper bound of each variable.
+	 * @param count Number of hypotheses.
+	 * @param seed Random generator seed, the same seed generates the same hypotheses.
+	 * @return Random hypotheses.
+	 */
+	[[nodiscard]] static std::vector<Eigen::VectorXf> randomHypotheses(
+		const Eigen::VectorXf &lower, const Eigen::VectorXf &upper, const size_t count, const uint32_t seed = 0) {
+		if (lower.size() != upper.size()) {
+			throw dv::exceptions::InvalidArgument<Eigen::Index>(
+				"Random hypotheses bounds must have the same dimensions.", upper.size());
+		}
+
+		std::mt19937 generator(seed);
+		std::uniform_real_distribution<float> distribution(0.f, 1.f);
+
+		std::vector<Eigen::VectorXf> hypotheses;
+		hypotheses.reserve(count);
+		for (size_t i = 0; i < count; i++) {
+			Eigen::VectorXf hypothesis(lower.size());
+			for (Eigen::Index d = 0; d < lower.size(); d++) {
+				hypothesis(d) = lower(d) + (upper(d) - lower(d)) * distribution(generator);
+			}
+			hypotheses.push_back(std::move(hypothesis));
+		}
+		return hypotheses;
+	}
+
+private:
+	/**
+	 * Evaluate the norm of the cost vector, non-finite costs are mapped to infinity.
+	 */
+	[[nodiscard]] float evaluateCost(const Eigen::VectorXf &variable) const {
+		Eigen::VectorXf cost(mFunctor->values());
+		(*mFunctor)(variable, cost);
+		return finiteCost(cost.norm());
+	}
+
+	/**
+	 * Map a non-finite cost norm to infinity.
+	 */
+	[[nodiscard]] static float finiteCost(const float norm) {
+		return std::isfinite(norm) ? norm : std::numeric_limits<float>::infinity();
+	}
+
+	/**
+	 * Wait for all futures before retrieving the results, so no task outlives the data it references even if one
+	 * of them throws.
+	 */
+	template<class Type>
+	[[nodiscard]] static std::vector<Type> collect(std::vector<std::future<Type>> &futures) {
+		for (auto &future : futures) {
+			future.wait();
+		}
+		std::vector<Type> results;
+		results.reserve(futures.size());
+		for (auto &future : futures) {
+			results.push_back(future.get());
+		}
+		return results;
+	}
 };
 
 } // namespace dv::optimization
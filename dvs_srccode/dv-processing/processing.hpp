@@ -7,6 +7,7 @@
 #include "camera/camera_geometry.hpp"
 #include "camera/stereo_geometry.hpp"
 #include "cluster/mean_shift.hpp"
+#include "containers/event_grid_index.hpp"
 #include "containers/kd_tree.hpp"
 #include "core/core.hpp"
 #include "core/event.hpp"
@@ -16,6 +17,7 @@
 #include "core/multi_stream_slicer.hpp"
 #include "core/stereo_event_stream_slicer.hpp"
 #include "core/stream_slicer.hpp"
+#include "core/thread_pool.hpp"
 #include "core/time.hpp"
 #include "core/utils.hpp"
 #include "data/boost_geometry_interop.hpp"
@@ -42,6 +44,7 @@
 #include "features/event_blob_detector.hpp"
 #include "features/event_combined_lk_tracker.hpp"
 #include "features/event_feature_lk_tracker.hpp"
+#include "features/event_patch_lk_tracker.hpp"
 #include "features/feature_detector.hpp"
 #include "features/feature_tracks.hpp"
 #include "features/image_feature_lk_tracker.hpp"
@@ -76,6 +79,7 @@
 #include "measurements/depth.hpp"
 #include "noise/background_activity_noise_filter.hpp"
 #include "noise/fast_decay_noise_filter.hpp"
+#include "optimization/contrast_maximization_engine.hpp"
 #include "optimization/contrast_maximization_rotation.hpp"
 #include "optimization/contrast_maximization_translation_and_depth.hpp"
 #include "optimization/contrast_maximization_wrapper.hpp"
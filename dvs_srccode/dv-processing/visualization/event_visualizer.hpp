@@ -5,6 +5,9 @@
 #include "../exception/exceptions/generic_exceptions.hpp"
 #include "colors.hpp"
 
+#include <numeric>
+#include <vector>
+
 namespace dv::visualization {
 
 /**
@@ -19,6 +22,62 @@ private:
 	cv::Vec3b positiveColor;
 	cv::Vec3b negativeColor;
 
+	/**
+	 * Number of events processed by a single parallel task when sorting events into row stripes.
+	 */
+	static constexpr size_t RenderEventChunkSize = 4096;
+
+	/**
+	 * Number of output rows in a single row stripe, each stripe is drawn by a single parallel task.
+	 */
+	static constexpr int RenderStripeHeight = 16;
+
+	int mDownscale = 1;
+
+	// Shallow reference to the output buffer of the last `render` call, used to clear only the pixels touched by
+	// that call. Holding the reference keeps the buffer allocated, so a new buffer can't reuse its address.
+	cv::Mat mRenderTarget;
+
+	std::vector<size_t> mStripeOffsets;
+	std::vector<uint32_t> mStripeEntries;
+	std::vector<std::vector<uint32_t>> mTouchedPixels;
+	std::vector<uint8_t> mTouchedMask;
+
+	/**
+	 * Draw the sorted stripe entries into the output image, after restoring the background color of the pixels
+	 * touched by the previous call.
+	 */
+	template<typename PixelType>
+	void drawStripes(cv::Mat &output, const PixelType background, const PixelType positive, const PixelType negative,
+		const size_t numChunks) {
+		const auto width = static_cast<uint32_t>(output.cols);
+		const auto pixelAt = [&output, width](const uint32_t pixel) -> PixelType & {
+			return output.ptr<PixelType>(static_cast<int>(pixel / width))[pixel % width];
+		};
+
+		cv::parallel_for_(cv::Range(0, static_cast<int>(mTouchedPixels.size())), [&](const cv::Range &range) {
+			for (int stripe = range.start; stripe < range.end; stripe++) {
+				auto &touched = mTouchedPixels[static_cast<size_t>(stripe)];
+				for (const uint32_t pixel : touched) {
+					pixelAt(pixel)      = background;
+					mTouchedMask[pixel] = 0;
+				}
+				touched.clear();
+
+				const size_t begin = mStripeOffsets[static_cast<size_t>(stripe) * numChunks];
+				const size_t end   = mStripeOffsets[(static_cast<size_t>(stripe) + 1) * numChunks];
+				for (size_t i = begin; i < end; i++) {
+					const uint32_t pixel = mStripeEntries[i] >> 1;
+					pixelAt(pixel)       = (mStripeEntries[i] & 1) ? positive : negative;
+					if (mTouchedMask[pixel] == 0) {
+						mTouchedMask[pixel] = 1;
+						touched.push_back(pixel);
+					}
+				}
+			}
+		});
+	}
+
 public:
 	/**
 	 * Initialize event visualizer.
@@ -70,6 +129,140 @@ public:
 		}
 	}
 
+	/**
+	 * Render events into a caller-owned image buffer that is reused across calls. The buffer can be a 3-channel
+	 * (BGR) or a 4-channel (BGRA) 8-bit unsigned integer image, an empty or incorrectly sized buffer is
+	 * (re)allocated with the same number of channels, defaulting to BGR. The output resolution is the event
+	 * resolution divided by the preview downscale factor, each output pixel receives the color of the latest event
+	 * within its block.
+	 *
+	 * When the same buffer is passed again, only the pixels drawn by the previous call are restored to the
+	 * background color, so the buffer must not be modified between calls; call `resetRenderState` after modifying
+	 * it. The visualizer keeps a reference to the last output buffer, so its memory is not released until the buffer
+	 * is replaced, `resetRenderState` is called or the visualizer is destroyed. Events are sorted into row stripes
+	 * and drawn in parallel. Events outside of the visualizer resolution are ignored.
+	 * @param events 	Input events.
+	 * @param output 	Output image buffer.
+	 * @throws InvalidArgument	An exception is thrown if the non-empty output buffer is neither `CV_8UC3` nor
+	 * 							`CV_8UC4` image.
+	 */
+	void render(const dv::EventStore &events, cv::Mat &output) {
+		if (!output.empty() && output.type() != CV_8UC3 && output.type() != CV_8UC4) {
+			throw dv::exceptions::InvalidArgument<int>(
+				"Visualizer requires 3-channel or 4-channel 8-bit unsigned integer image for rendering",
+				output.type());
+		}
+
+		const cv::Size outputSize = getPreviewResolution();
+		output.create(outputSize, output.type() == CV_8UC4 ? CV_8UC4 : CV_8UC3);
+
+		const size_t numStripes
+			= static_cast<size_t>((outputSize.height + RenderStripeHeight - 1) / RenderStripeHeight);
+		const size_t area = outputSize.area();
+
+		if (output.data != mRenderTarget.data || output.size() != mRenderTarget.size()
+			|| output.type() != mRenderTarget.type() || mTouchedPixels.size() != numStripes) {
+			// The alpha value is ignored for 3-channel images
+			output.setTo(cv::Scalar(backgroundColor[0], backgroundColor[1], backgroundColor[2], 255));
+			mTouchedPixels.assign(numStripes, {});
+			mTouchedMask.assign(area, 0);
+			mRenderTarget = output;
+		}
+
+		// Sort events into row stripes, preserving their order within each stripe: counts of each chunk and stripe
+		// are converted into stripe-major offsets by a prefix sum, then each chunk writes its entries at its offsets
+		const size_t numEvents = events.size();
+		const size_t numChunks = std::max<size_t>((numEvents + RenderEventChunkSize - 1) / RenderEventChunkSize, 1);
+		const auto downscale   = static_cast<int16_t>(mDownscale);
+		const auto stripeHeight = static_cast<int16_t>(RenderStripeHeight);
+		const auto forEachEvent = [&](const size_t chunk, auto &&callback) {
+			const size_t start = chunk * RenderEventChunkSize;
+			if (start >= numEvents) {
+				return;
+			}
+			for (const auto &event : events.slice(start, std::min(RenderEventChunkSize, numEvents - start))) {
+				if (dv::isWithinDimensions(event, resolution)) {
+					const int16_t y = event.y() / downscale;
+					callback(static_cast<size_t>(y / stripeHeight),
+						static_cast<uint32_t>(y * outputSize.width + event.x() / downscale) << 1
+							| static_cast<uint32_t>(event.polarity()));
+				}
+			}
+		};
+
+		mStripeOffsets.assign(numStripes * numChunks + 1, 0);
+		cv::parallel_for_(cv::Range(0, static_cast<int>(numChunks)), [&](const cv::Range &range) {
+			for (int chunk = range.start; chunk < range.end; chunk++) {
+				forEachEvent(static_cast<size_t>(chunk), [&](const size_t stripe, uint32_t) {
+					mStripeOffsets[stripe * numChunks + static_cast<size_t>(chunk) + 1]++;
+				});
+			}
+		});
+		std::partial_sum(mStripeOffsets.begin(), mStripeOffsets.end(), mStripeOffsets.begin());
+
+		mStripeEntries.resize(mStripeOffsets.back());
+		cv::parallel_for_(cv::Range(0, static_cast<int>(numChunks)), [&](const cv::Range &range) {
+			std::vector<size_t> positions(numStripes);
+			for (int chunk = range.start; chunk < range.end; chunk++) {
+				for (size_t stripe = 0; stripe < numStripes; stripe++) {
+					positions[stripe] = mStripeOffsets[stripe * numChunks + static_cast<size_t>(chunk)];
+				}
+				forEachEvent(static_cast<size_t>(chunk), [&](const size_t stripe, const uint32_t entry) {
+					mStripeEntries[positions[stripe]++] = entry;
+				});
+			}
+		});
+
+		if (output.type() == CV_8UC4) {
+			const auto toBGRA = [](const cv::Vec3b &color) {
+				return cv::Vec4b(color[0], color[1], color[2], 255);
+			};
+			drawStripes<cv::Vec4b>(
+				output, toBGRA(backgroundColor), toBGRA(positiveColor), toBGRA(negativeColor), numChunks);
+		}
+		else {
+			drawStripes<cv::Vec3b>(output, backgroundColor, positiveColor, negativeColor, numChunks);
+		}
+	}
+
+	/**
+	 * Forget the pixels drawn by the last `render` call and release the reference to its output buffer, the next
+	 * call will fill the whole output buffer with the background color.
+	 */
+	void resetRenderState() {
+		mRenderTarget.release();
+	}
+
+	/**
+	 * Get the resolution of images produced by `render`.
+	 * @return 	Event resolution divided by the preview downscale factor, rounded up.
+	 */
+	[[nodiscard]] cv::Size getPreviewResolution() const {
+		return {(resolution.width + mDownscale - 1) / mDownscale, (resolution.height + mDownscale - 1) / mDownscale};
+	}
+
+	/**
+	 * Get the preview downscale factor used by `render`.
+	 * @return 	Preview downscale factor.
+	 */
+	[[nodiscard]] int getPreviewDownscale() const {
+		return mDownscale;
+	}
+
+	/**
+	 * Set the preview downscale factor used by `render`, events are mapped into output pixels by integer division
+	 * of their coordinates by this factor.
+	 * @param downscale 	Preview downscale factor, 1 renders at full resolution.
+	 * @throws InvalidArgument	An exception is thrown if the factor is smaller than 1.
+	 */
+	void setPreviewDownscale(const int downscale) {
+		if (downscale < 1) {
+			throw dv::exceptions::InvalidArgument<int>("Preview downscale factor must be at least 1", downscale);
+		}
+		mDownscale = downscale;
+		resetRenderState();
+	}
+
 	/**
 	 * Get currently configured background color.
 	 * @return	Background color.
@@ -85,6 +278,7 @@ public:
 	void setBackgroundColor(const cv::Scalar &backgroundColor_) {
 		backgroundColor = cv::Vec3b(static_cast<uint8_t>(backgroundColor_(0)),
 			static_cast<uint8_t>(backgroundColor_(1)), static_cast<uint8_t>(backgroundColor_(2)));
+		resetRenderState();
 	}
 
 	/**
@@ -10,6 +10,7 @@
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
+#include <boost/circular_buffer.hpp>
 #include <fmt/format.h>
 #include <opencv2/opencv.hpp>
 
@@ -20,6 +21,13 @@ namespace dv::visualization {
 
 /**
  * Visualize the current and past poses as an image.
+ *
+ * The scene is rendered incrementally: the background, the grid and the world frame are cached in a static layer,
+ * the trajectory is drawn on top of it into a persistent layer, where only the segments added since the previous
+ * frame are drawn. The whole scene is redrawn only when the view changes, i.e. the camera pose, the view mode, the
+ * bounds of the trajectory or the drawing parameters change, and the trajectory layer is redrawn when the oldest
+ * positions are dropped from a full trajectory buffer. The current pose, text and landmarks are drawn on a copy of
+ * the cached layers on each call to `generateFrame`.
  */
 class PoseVisualizer {
 public:
@@ -67,6 +75,9 @@ private:
 	Eigen::Vector4f mMinPoint_W;
 	Eigen::Vector4f mMaxPoint_W;
 
+	// Fraction of the span by which the min and max coordinates are extended beyond a position that exceeds them
+	float mBoundsHeadroom = 0.f;
+
 	// Size of a robot coordinate frame visualization
 	float mFrameSize = 1.0; // [m]
 
@@ -79,7 +90,7 @@ private:
 	bool mDrawLinesToMarker = true;
 
 private:
-	std::vector<int64_t> mTimestamps;
+	boost::circular_buffer<int64_t> mTimestamps;
 
 	// For convenience keep the last pose separately
 	dv::kinematics::Transformationf mLastPose;
@@ -96,6 +107,23 @@ private:
 	// Offset of the positions
 	dv::kinematics::Transformationf mT_OW; // Transformation from "World" to "Offset" frame
 
+	// Cached render layers: background, grid and world frame in the static layer, the static layer with the drawn
+	// trajectory segments in the trajectory layer
+	cv::Mat mStaticLayer;
+	cv::Mat mTrajectoryLayer;
+
+	// View parameters derived in `updateView`
+	Eigen::Vector4f mPoseMask = Eigen::Vector4f::Ones();
+	int mGridSpan             = 100; // [cm]
+	long mHeightCoordinate    = 2;
+
+	// Whether the whole scene or only the trajectory layer have to be redrawn
+	bool mViewDirty       = true;
+	bool mTrajectoryDirty = true;
+
+	// Number of path positions added since the trajectory layer was last updated
+	size_t mPendingPoints = 0;
+
 	/**
 	 * Convert a pose from 3D coordinates to image frame.
 	 *
@@ -124,6 +152,32 @@ private:
 			static_cast<float>(mResolution.height) / 2.f, 0, 0, 1;
 	}
 
+	/**
+	 * Update the world to camera transformation from the current camera position and orientation.
+	 */
+	void refreshCameraTransform() {
+		const auto transform = dv::kinematics::Transformationf(0, mCameraPosition, mCameraOrientation);
+		mT_CW                = transform.inverse().getTransform();
+	}
+
+	/**
+	 * Convert XYZ Euler angles into a rotation.
+	 *
+	 * @param yawDeg		Yaw in degrees
+	 * @param pitchDeg		Pitch in degrees
+	 * @param rollDeg		Roll in degrees
+	 * @return 				Rotation quaternion
+	 */
+	[[nodiscard]] static Eigen::Quaternionf eulerToQuaternion(
+		const float yawDeg, const float pitchDeg, const float rollDeg) {
+		static constexpr float toRad = 1.f / 180.f * std::numbers::pi_v<float>;
+
+		// The axes in euler angles should be reversed (notice the Z-Y-X ordering)
+		return Eigen::AngleAxisf(rollDeg * toRad, Eigen::Vector3f::UnitZ())
+			 * Eigen::AngleAxisf(pitchDeg * toRad, Eigen::Vector3f::UnitY())
+			 * Eigen::AngleAxisf(yawDeg * toRad, Eigen::Vector3f::UnitX());
+	}
+
 	/**
 	 * Initialize minimum and maximum point coordinates.
 	 */
@@ -154,6 +208,256 @@ private:
 		return gridSpans.back();
 	}
 
+	/**
+	 * Position the camera according to the view mode and the bounds of the trajectory, and derive the view
+	 * parameters used for drawing.
+	 */
+	void updateView() {
+		const auto pointsSpan = mMaxPoint_W - mMinPoint_W;
+		auto smallerDimension = static_cast<const float>(std::min(mResolution.width, mResolution.height));
+		const auto midPoint   = mMinPoint_W + pointsSpan / 2;
+		float maxSpan         = 1.f;
+
+		// Set the position and orientation of the camera
+		switch (mViewMode) {
+			case Mode::CUSTOM:
+				mPoseMask         = Eigen::Vector4f(1, 1, 1, 1);
+				mHeightCoordinate = 2;
+				break;
+			case Mode::VIEW_XY: {
+				maxSpan                      = std::max(pointsSpan.x(), pointsSpan.y());
+				mPoseMask                    = Eigen::Vector4f(1, 1, 0, 1);
+				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
+				const auto newCamPose        = Eigen::Vector3f(midPoint.x(), midPoint.y(), requiredDistance + 0.1f);
+				mCameraPosition              = newCamPose;
+				mCameraOrientation           = eulerToQuaternion(180.f, 0.f, 0.f);
+				mHeightCoordinate            = 2;
+				break;
+			}
+			case Mode::VIEW_YZ: {
+				maxSpan                      = std::max(pointsSpan.y(), pointsSpan.z());
+				mPoseMask                    = Eigen::Vector4f(0, 1, 1, 1);
+				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
+				const auto newCamPose        = Eigen::Vector3f(requiredDistance + 0.1f, midPoint.y(), midPoint.z());
+				mCameraPosition              = newCamPose;
+				mCameraOrientation           = eulerToQuaternion(-90.f, 0.f, 90.f);
+				mHeightCoordinate            = 0;
+				break;
+			}
+			case Mode::VIEW_ZX: {
+				maxSpan                      = std::max(pointsSpan.x(), pointsSpan.z());
+				mPoseMask                    = Eigen::Vector4f(1, 0, 1, 1);
+				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
+				const auto newCamPose        = Eigen::Vector3f(midPoint.x(), requiredDistance + 0.1f, midPoint.z());
+				mCameraPosition              = newCamPose;
+				mCameraOrientation           = eulerToQuaternion(-90.f, -90.f, 180.f);
+				mHeightCoordinate            = 1;
+				break;
+			}
+			case Mode::VIEW_XZ: {
+				maxSpan                      = std::max(pointsSpan.x(), pointsSpan.z());
+				mPoseMask                    = Eigen::Vector4f(1, 0, 1, 1);
+				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
+				const auto newCamPose        = Eigen::Vector3f(midPoint.x(), -(requiredDistance + 0.1f), midPoint.z());
+				mCameraPosition              = newCamPose;
+				mCameraOrientation           = eulerToQuaternion(-90.f, 0.f, 0.f);
+				mHeightCoordinate            = 2;
+				break;
+			}
+			case Mode::VIEW_YX: {
+				maxSpan                      = std::max(pointsSpan.y(), pointsSpan.x());
+				mPoseMask                    = Eigen::Vector4f(1, 1, 0, 1);
+				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
+				const auto newCamPose        = Eigen::Vector3f(midPoint.x(), midPoint.y(), -(requiredDistance + 0.1f));
+				mCameraPosition              = newCamPose;
+				mCameraOrientation           = eulerToQuaternion(0.f, 0.f, 90.f);
+				mHeightCoordinate            = 0;
+				break;
+			}
+			case Mode::VIEW_ZY: {
+				maxSpan                      = std::max(pointsSpan.y(), pointsSpan.z());
+				mPoseMask                    = Eigen::Vector4f(0, 1, 1, 1);
+				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
+				const auto newCamPose        = Eigen::Vector3f(-(requiredDistance + 0.1f), midPoint.y(), midPoint.z());
+				mCameraPosition              = newCamPose;
+				mCameraOrientation           = eulerToQuaternion(0.f, -90.f, 180.f);
+				mHeightCoordinate            = 1;
+				break;
+			}
+			default:
+				throw std::runtime_error("Incorrect mode");
+		}
+
+		if (mViewMode != Mode::CUSTOM) {
+			refreshCameraTransform();
+		}
+		mGridSpan = getGridSpan(maxSpan);
+	}
+
+	/**
+	 * Draw the background, the grid and the world frame into the static layer.
+	 */
+	void renderStaticLayer() {
+		auto &image = mStaticLayer;
+		image.create(mResolution, CV_8UC3);
+		image.setTo(mBackgroundColor);
+
+		// Draw the grid on the image
+		const auto gridOffset           = Eigen::Vector4f(10.f, 10.f, 10.f, 1.f);
+		const Eigen::Vector4i gridStart = (mMinPoint_W - gridOffset).cast<int>() * 100; // [cm]
+		const Eigen::Vector4i gridEnd   = (mMaxPoint_W + gridOffset).cast<int>() * 100; // [cm]
+
+		// Draw grid by iterating over one index and keeping another index constant
+		auto drawGrid = [&image, &gridStart, &gridEnd, this](long iteratingIdx, long constantIdx) {
+			assert(0 <= iteratingIdx && iteratingIdx <= 2);
+			assert(0 <= constantIdx && constantIdx <= 2);
+
+			for (int majorCoord = gridStart[iteratingIdx]; majorCoord <= gridEnd[iteratingIdx];
+				 majorCoord     += mGridSpan) {
+				auto from_W          = Eigen::Vector4f(0.f, 0.f, 0.f, 1.f);
+				auto to_W            = Eigen::Vector4f(0.f, 0.f, 0.f, 1.f);
+				from_W[iteratingIdx] = static_cast<float>(majorCoord) / 100.f;             // [m]
+				to_W[iteratingIdx]   = static_cast<float>(majorCoord) / 100.f;             // [m]
+				from_W[constantIdx]  = static_cast<float>(gridStart[constantIdx]) / 100.f; // [m]
+				to_W[constantIdx]    = static_cast<float>(gridEnd[constantIdx]) / 100.f;   // [m]
+
+				const auto from_I = projectPose(from_W);
+				const auto to_I   = projectPose(to_W);
+
+				if (from_I == cv::Point2f() || to_I == cv::Point2f()) {
+					continue;
+				}
+
+				cv::line(image, from_I, to_I, mGridColor, 1, cv::LINE_AA);
+			}
+		};
+
+		switch (mGridPlane) {
+			case GridPlane::PLANE_NONE: {
+				break;
+			}
+			case GridPlane::PLANE_XY: {
+				drawGrid(0, 1);
+				drawGrid(1, 0);
+				break;
+			}
+			case GridPlane::PLANE_YZ: {
+				drawGrid(1, 2);
+				drawGrid(2, 1);
+				break;
+			}
+			case GridPlane::PLANE_ZX: {
+				drawGrid(0, 2);
+				drawGrid(2, 0);
+				break;
+			}
+			default:
+				throw std::runtime_error("Incorrect grid plane mode");
+		}
+
+		// Draw the World frame
+		// W - world
+		// C - camera
+		// I - image (2D)
+		// CW - transformation from world to camera
+		auto origin_W   = Eigen::Vector4f(0.f, 0.f, 0.f, 1.f);
+		auto xAxisEnd_W = Eigen::Vector4f(mFrameSize, 0.f, 0.f, 1.f);
+		auto yAxisEnd_W = Eigen::Vector4f(0.f, mFrameSize, 0.f, 1.f);
+		auto zAxisEnd_W = Eigen::Vector4f(0.f, 0.f, mFrameSize, 1.f);
+
+		auto origin_I   = projectPose(origin_W, mPoseMask);
+		auto xAxisEnd_I = projectPose(xAxisEnd_W, mPoseMask);
+		auto yAxisEnd_I = projectPose(yAxisEnd_W, mPoseMask);
+		auto zAxisEnd_I = projectPose(zAxisEnd_W, mPoseMask);
+		if (origin_I != cv::Point2f()) {
+			const auto axisLabelOffset = cv::Point2f(10.f, 10.f);
+
+			if (xAxisEnd_I != cv::Point2f()) {
+				cv::arrowedLine(
+					image, origin_I, xAxisEnd_I, cv::Scalar(0, 0, 255), mLineThickness, cv::LINE_AA, 0, 0.05);
+				cv::putText(
+					image, "x", xAxisEnd_I + axisLabelOffset, cv::FONT_HERSHEY_COMPLEX, 0.5, cv::Scalar(0, 0, 255), 1);
+			}
+
+			if (yAxisEnd_I != cv::Point2f()) {
+				cv::arrowedLine(
+					image, origin_I, yAxisEnd_I, cv::Scalar(0, 255, 0), mLineThickness, cv::LINE_AA, 0, 0.05);
+				cv::putText(
+					image, "y", yAxisEnd_I + axisLabelOffset, cv::FONT_HERSHEY_COMPLEX, 0.5, cv::Scalar(0, 255, 0), 1);
+			}
+
+			if (zAxisEnd_I != cv::Point2f()) {
+				cv::arrowedLine(
+					image, origin_I, zAxisEnd_I, cv::Scalar(255, 0, 0), mLineThickness, cv::LINE_AA, 0, 0.05);
+				cv::putText(
+					image, "z", zAxisEnd_I + axisLabelOffset, cv::FONT_HERSHEY_COMPLEX, 0.5, cv::Scalar(255, 0, 0), 1);
+			}
+		}
+	}
+
+	/**
+	 * Draw trajectory segments into an image.
+	 *
+	 * @param image 		Image to draw on
+	 * @param firstSegment 	Index of the first drawn segment, segment `i` connects path positions `i` and `i + 1`
+	 */
+	void drawTrajectory(cv::Mat &image, const size_t firstSegment) const {
+		if (firstSegment + 1 >= mPath.size()) {
+			return;
+		}
+
+		const auto color1       = cv::Scalar(255, 255, 0);
+		const auto color2       = cv::Scalar(0, 255, 255);
+		const float heightMin   = mMinPoint_W[mHeightCoordinate];
+		const float heightRange = mMaxPoint_W[mHeightCoordinate] - heightMin;
+
+		// Each position is projected once, the end of a segment is the start of the next one
+		const cv::Point2f zeroPoint;
+		cv::Point2f from = projectPose(mPath[firstSegment], mPoseMask);
+		for (size_t i = firstSegment; i + 1 < mPath.size(); ++i) {
+			const cv::Point2f to = projectPose(mPath[i + 1], mPoseMask);
+
+			const cv::Point2f diff = to - from;
+			if (diff.dot(diff) < std::numeric_limits<float>::epsilon() || from == zeroPoint || to == zeroPoint) {
+				// short segment || invalid from || invalid to
+				from = to;
+				continue;
+			}
+
+			const float relHeight
+				= (mPath[i][mHeightCoordinate] - heightMin + mPath[i + 1][mHeightCoordinate] - heightMin) * 0.5f
+				/ heightRange;
+			cv::line(image, from, to, relHeight * color1 + (1.0f - relHeight) * color2, mLineThickness, cv::LINE_AA);
+			from = to;
+		}
+	}
+
+	/**
+	 * Bring the cached layers up to date: redraw everything if the view changed, redraw the trajectory if segments
+	 * were dropped from it, otherwise draw only the newly added segments.
+	 */
+	void updateLayers() {
+		if (mViewDirty) {
+			updateView();
+			renderStaticLayer();
+			mTrajectoryDirty = true;
+		}
+
+		if (mTrajectoryDirty) {
+			mStaticLayer.copyTo(mTrajectoryLayer);
+			drawTrajectory(mTrajectoryLayer, 0);
+		}
+		else if (mPendingPoints > 0) {
+			// The first new segment starts at the last position that was already drawn
+			const size_t firstSegment = mPath.size() > mPendingPoints ? mPath.size() - mPendingPoints - 1 : 0;
+			drawTrajectory(mTrajectoryLayer, firstSegment);
+		}
+
+		mViewDirty       = false;
+		mTrajectoryDirty = false;
+		mPendingPoints   = 0;
+	}
+
 public:
 	EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
@@ -168,6 +472,7 @@ public:
 		mPath(trajectoryLength),
 		mTrajectory(trajectoryLength),
 		mMarkerLimit(trajectoryLength),
+		mTimestamps(trajectoryLength),
 		mLastPose() {
 		initMinMax();
 		refreshCameraMatrix();
@@ -182,9 +487,9 @@ public:
 	 * @param newPosition New translational position of the camera in world coordinate frame.
 	 */
 	void updateCameraPosition(const Eigen::Vector3f &newPosition) {
-		mCameraPosition      = newPosition;
-		const auto transform = dv::kinematics::Transformationf(0, mCameraPosition, mCameraOrientation);
-		mT_CW                = transform.inverse().getTransform();
+		mCameraPosition = newPosition;
+		refreshCameraTransform();
+		mViewDirty = true;
 	}
 
 	/**
@@ -193,7 +498,8 @@ public:
 	 * @param mode New viewing mode
 	 */
 	void setViewMode(const Mode mode) {
-		mViewMode = mode;
+		mViewMode  = mode;
+		mViewDirty = true;
 	}
 
 	void setViewMode(const std::string &str) {
@@ -210,7 +516,8 @@ public:
 		if (it == stringToMode.end()) {
 			throw std::invalid_argument("Incorrect view mode: " + str);
 		}
-		mViewMode = it->second;
+		mViewMode  = it->second;
+		mViewDirty = true;
 	}
 
 	/**
@@ -220,6 +527,7 @@ public:
 	 */
 	void setGridPlane(const GridPlane plane) {
 		mGridPlane = plane;
+		mViewDirty = true;
 	}
 
 	void setGridPlane(const std::string &str) {
@@ -235,6 +543,7 @@ public:
 			throw std::invalid_argument("Incorrect grid plane: " + str);
 		}
 		mGridPlane = it->second;
+		mViewDirty = true;
 	}
 
 	/**
@@ -245,14 +554,9 @@ public:
 	 * @param rollDeg		Camera roll in degrees
 	 */
 	void updateCameraOrientation(const float yawDeg, const float pitchDeg, const float rollDeg) {
-		static constexpr float toRad = 1.f / 180.f * std::numbers::pi_v<float>;
-
-		// The axes in euler angles should be reversed (notice the Z-Y-X ordering)
-		mCameraOrientation = Eigen::AngleAxisf(rollDeg * toRad, Eigen::Vector3f::UnitZ())
-						   * Eigen::AngleAxisf(pitchDeg * toRad, Eigen::Vector3f::UnitY())
-						   * Eigen::AngleAxisf(yawDeg * toRad, Eigen::Vector3f::UnitX());
-		auto transform = dv::kinematics::Transformationf(0, mCameraPosition, mCameraOrientation);
-		mT_CW          = transform.inverse().getTransform();
+		mCameraOrientation = eulerToQuaternion(yawDeg, pitchDeg, rollDeg);
+		refreshCameraTransform();
+		mViewDirty = true;
 	}
 
 	/**
@@ -264,6 +568,7 @@ public:
 		mResolution = newSize;
 
 		refreshCameraMatrix();
+		mViewDirty = true;
 	}
 
 	/**
@@ -274,6 +579,7 @@ public:
 	void setCoordinateDimensions(const float newSize) {
 		assert(newSize > 0.f);
 		mFrameSize = newSize;
+		mViewDirty = true;
 	}
 
 	/**
@@ -284,6 +590,7 @@ public:
 	void setLineThickness(const int newThickness) {
 		assert(newThickness >= 1);
 		mLineThickness = newThickness;
+		mViewDirty     = true;
 	}
 
 	/**
@@ -332,33 +639,34 @@ public:
 		Eigen::Vector4f position4(position.x(), position.y(), position.z(), 1.0);
 		// If moves at least one centimeter
 		if (mPath.empty() || (position4 - mPath.back()).norm() > 0.01) {
-			// Add a new point
+			// Add a new point, the oldest segment of a full path is dropped and the trajectory has to be redrawn
+			if (mPath.full()) {
+				mTrajectoryDirty = true;
+			}
 			mPath.push_back(position4);
-			mTimestamps.emplace_back(mLastTimestamp);
+			mTimestamps.push_back(mLastTimestamp);
+			mPendingPoints++;
 		}
 		else {
 			// Just update the last position timestamp instead of pushing this into a the trajectory
 			mTimestamps.back() = mLastTimestamp;
 		}
 
-		// Make sure that there is always mFrameSize meters frame around the drawn trajectory
-		if (position.x() < mMinPoint_W.x()) {
-			mMinPoint_W.x() = position.x();
-		}
-		if (position.y() < mMinPoint_W.y()) {
-			mMinPoint_W.y() = position.y();
-		}
-		if (position.z() < mMinPoint_W.z()) {
-			mMinPoint_W.z() = position.z();
-		}
-		if (position.x() > mMaxPoint_W.x()) {
-			mMaxPoint_W.x() = position.x();
-		}
-		if (position.y() > mMaxPoint_W.y()) {
-			mMaxPoint_W.y() = position.y();
+		// Make sure that there is always mFrameSize meters frame around the drawn trajectory. The view depends on the
+		// bounds and is redrawn when they change, optional headroom reduces the number of redraws
+		bool boundsChanged = false;
+		for (long i = 0; i < 3; i++) {
+			if (position4[i] < mMinPoint_W[i]) {
+				mMinPoint_W[i] = position4[i] - mBoundsHeadroom * (mMaxPoint_W[i] - position4[i]);
+				boundsChanged  = true;
+			}
+			if (position4[i] > mMaxPoint_W[i]) {
+				mMaxPoint_W[i] = position4[i] + mBoundsHeadroom * (position4[i] - mMinPoint_W[i]);
+				boundsChanged  = true;
+			}
 		}
-		if (position.z() > mMaxPoint_W.z()) {
-			mMaxPoint_W.z() = position.z();
+		if (boundsChanged) {
+			mViewDirty = true;
 		}
 
 		// Update the bookkeping
@@ -379,220 +687,16 @@ public:
 	}
 
 	/**
-	 * Return a visualization image.
+	 * Return a visualization image. Only the parts of the scene that changed since the previous call are redrawn.
 	 *
 	 * @return The generated image.
 	 */
 	[[nodiscard]] dv::Frame generateFrame() {
-		// Initialize variables used to draw on the image
-		auto image            = cv::Mat(mResolution, CV_8UC3, mBackgroundColor);
-		const auto pointsSpan = mMaxPoint_W - mMinPoint_W;
-		auto smallerDimension = static_cast<const float>(std::min(mResolution.width, mResolution.height));
-		const auto midPoint   = mMinPoint_W + pointsSpan / 2;
-		float maxSpan         = 1.f;
-		auto poseMask         = Eigen::Vector4f(1, 1, 1, 1);
-
-		// Set the position and orientation of the camera
-		switch (mViewMode) {
-			case Mode::CUSTOM:
-				break;
-			case Mode::VIEW_XY: {
-				maxSpan                      = std::max(pointsSpan.x(), pointsSpan.y());
-				poseMask                     = Eigen::Vector4f(1, 1, 0, 1);
-				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
-				auto newCamPose              = Eigen::Vector3f(midPoint.x(), midPoint.y(), requiredDistance + 0.1f);
-				updateCameraPosition(newCamPose);
-				updateCameraOrientation(180.f, 0.f, 0.f);
-				break;
-			}
-			case Mode::VIEW_YZ: {
-				maxSpan                      = std::max(pointsSpan.y(), pointsSpan.z());
-				poseMask                     = Eigen::Vector4f(0, 1, 1, 1);
-				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
-				auto newCamPose              = Eigen::Vector3f(requiredDistance + 0.1f, midPoint.y(), midPoint.z());
-				updateCameraPosition(newCamPose);
-				updateCameraOrientation(-90.f, 0.f, 90.f);
-				break;
-			}
-			case Mode::VIEW_ZX: {
-				maxSpan                      = std::max(pointsSpan.x(), pointsSpan.z());
-				poseMask                     = Eigen::Vector4f(1, 0, 1, 1);
-				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
-				auto newCamPose              = Eigen::Vector3f(midPoint.x(), requiredDistance + 0.1f, midPoint.z());
-				updateCameraPosition(newCamPose);
-				updateCameraOrientation(-90.f, -90.f, 180.f);
-				break;
-			}
-			case Mode::VIEW_XZ: {
-				maxSpan                      = std::max(pointsSpan.x(), pointsSpan.z());
-				poseMask                     = Eigen::Vector4f(1, 0, 1, 1);
-				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
-				auto newCamPose              = Eigen::Vector3f(midPoint.x(), -(requiredDistance + 0.1f), midPoint.z());
-				updateCameraPosition(newCamPose);
-				updateCameraOrientation(-90.f, 0.f, 0.f);
-				break;
-			}
-			case Mode::VIEW_YX: {
-				maxSpan                      = std::max(pointsSpan.y(), pointsSpan.x());
-				poseMask                     = Eigen::Vector4f(1, 1, 0, 1);
-				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
-				auto newCamPose              = Eigen::Vector3f(midPoint.x(), midPoint.y(), -(requiredDistance + 0.1f));
-				updateCameraPosition(newCamPose);
-				updateCameraOrientation(0.f, 0.f, 90.f);
-				break;
-			}
-			case Mode::VIEW_ZY: {
-				maxSpan                      = std::max(pointsSpan.y(), pointsSpan.z());
-				poseMask                     = Eigen::Vector4f(0, 1, 1, 1);
-				const float requiredDistance = maxSpan * mFocalLength / smallerDimension;
-				auto newCamPose              = Eigen::Vector3f(-(requiredDistance + 0.1f), midPoint.y(), midPoint.z());
-				updateCameraPosition(newCamPose);
-				updateCameraOrientation(0.f, -90.f, 180.f);
-				break;
-			}
-			default:
-				throw std::runtime_error("Incorrect mode");
-		}
-
-		// Draw the grid on the image
-		const int gridSpan              = getGridSpan(maxSpan); // [cm]
-		const auto gridOffset           = Eigen::Vector4f(10.f, 10.f, 10.f, 1.f);
-		const Eigen::Vector4i gridStart = (mMinPoint_W - gridOffset).cast<int>() * 100; // [cm]
-		const Eigen::Vector4i gridEnd   = (mMaxPoint_W + gridOffset).cast<int>() * 100; // [cm]
-
-		// Draw grid by iterating over one index and keeping another index constant
-		auto drawGrid = [&image, &gridStart, &gridEnd, &gridSpan, this](long iteratingIdx, long constantIdx) {
-			assert(0 <= iteratingIdx && iteratingIdx <= 2);
-			assert(0 <= constantIdx && constantIdx <= 2);
-
-			for (int majorCoord = gridStart[iteratingIdx]; majorCoord <= gridEnd[iteratingIdx];
-				 majorCoord     += gridSpan) {
-				auto from_W          = Eigen::Vector4f(0.f, 0.f, 0.f, 1.f);
-				auto to_W            = Eigen::Vector4f(0.f, 0.f, 0.f, 1.f);
-				from_W[iteratingIdx] = static_cast<float>(majorCoord) / 100.f;             // [m]
-				to_W[iteratingIdx]   = static_cast<float>(majorCoord) / 100.f;             // [m]
-				from_W[constantIdx]  = static_cast<float>(gridStart[constantIdx]) / 100.f; // [m]
-				to_W[constantIdx]    = static_cast<float>(gridEnd[constantIdx]) / 100.f;   // [m]
+		updateLayers();
 
-				const auto from_I = projectPose(from_W);
-				const auto to_I   = projectPose(to_W);
-
-				if (from_I == cv::Point2f() || to_I == cv::Point2f()) {
-					continue;
-				}
-
-				cv::line(image, from_I, to_I, mGridColor, 1, cv::LINE_AA);
-			}
-		};
-
-		switch (mGridPlane) {
-			case GridPlane::PLANE_NONE: {
-				break;
-			}
-			case GridPlane::PLANE_XY: {
-				drawGrid(0, 1);
-				drawGrid(1, 0);
-				break;
-			}
-			case GridPlane::PLANE_YZ: {
-				drawGrid(1, 2);
-				drawGrid(2, 1);
-				break;
-			}
-			case GridPlane::PLANE_ZX: {
-				drawGrid(0, 2);
-				drawGrid(2, 0);
-				break;
-			}
-			default:
-				throw std::runtime_error("Incorrect grid plane mode");
-		}
-
-		// Draw the World frame
-		// W - world
-		// C - camera
-		// I - image (2D)
-		// CW - transformation from world to camera
-		auto origin_W   = Eigen::Vector4f(0.f, 0.f, 0.f, 1.f);
-		auto xAxisEnd_W = Eigen::Vector4f(mFrameSize, 0.f, 0.f, 1.f);
-		auto yAxisEnd_W = Eigen::Vector4f(0.f, mFrameSize, 0.f, 1.f);
-		auto zAxisEnd_W = Eigen::Vector4f(0.f, 0.f, mFrameSize, 1.f);
-
-		auto origin_I   = projectPose(origin_W, poseMask);
-		auto xAxisEnd_I = projectPose(xAxisEnd_W, poseMask);
-		auto yAxisEnd_I = projectPose(yAxisEnd_W, poseMask);
-		auto zAxisEnd_I = projectPose(zAxisEnd_W, poseMask);
-		if (origin_I != cv::Point2f()) {
-			const auto axisLabelOffset = cv::Point2f(10.f, 10.f);
-
-			if (xAxisEnd_I != cv::Point2f()) {
-				cv::arrowedLine(
-					image, origin_I, xAxisEnd_I, cv::Scalar(0, 0, 255), mLineThickness, cv::LINE_AA, 0, 0.05);
-				cv::putText(
-					image, "x", xAxisEnd_I + axisLabelOffset, cv::FONT_HERSHEY_COMPLEX, 0.5, cv::Scalar(0, 0, 255), 1);
-			}
-
-			if (yAxisEnd_I != cv::Point2f()) {
-				cv::arrowedLine(
-					image, origin_I, yAxisEnd_I, cv::Scalar(0, 255, 0), mLineThickness, cv::LINE_AA, 0, 0.05);
-				cv::putText(
-					image, "y", yAxisEnd_I + axisLabelOffset, cv::FONT_HERSHEY_COMPLEX, 0.5, cv::Scalar(0, 255, 0), 1);
-			}
-
-			if (zAxisEnd_I != cv::Point2f()) {
-				cv::arrowedLine(
-					image, origin_I, zAxisEnd_I, cv::Scalar(255, 0, 0), mLineThickness, cv::LINE_AA, 0, 0.05);
-				cv::putText(
-					image, "z", zAxisEnd_I + axisLabelOffset, cv::FONT_HERSHEY_COMPLEX, 0.5, cv::Scalar(255, 0, 0), 1);
-			}
-		}
-
-		// Draw the path history
-		const cv::Point2f zeroPoint;
-		for (size_t i = 0; i + 1 < mPath.size(); ++i) {
-			auto from = projectPose(mPath.at(i), poseMask);
-			auto to   = projectPose(mPath.at(i + 1), poseMask);
-
-			cv::Point2f diff = to - from;
-			if (diff.dot(diff) < std::numeric_limits<float>::epsilon() || from == zeroPoint || to == zeroPoint) {
-				// short segment || invalid from || invalid to
-				continue;
-			}
-
-			auto relativeHeight = [&i, this](long coordinate) {
-				assert(0 <= coordinate && coordinate <= 2);
-
-				return (mPath.at(i)[coordinate] - mMinPoint_W[coordinate] + mPath.at(i + 1)[coordinate]
-						   - mMinPoint_W[coordinate])
-					 * 0.5f / (mMaxPoint_W[coordinate] - mMinPoint_W[coordinate]);
-			};
-
-			float relHeight;
-			switch (mViewMode) {
-				case Mode::CUSTOM:
-				case Mode::VIEW_XY:
-				case Mode::VIEW_XZ: {
-					relHeight = relativeHeight(2);
-					break;
-				}
-				case Mode::VIEW_YX:
-				case Mode::VIEW_YZ: {
-					relHeight = relativeHeight(0);
-					break;
-				}
-				case Mode::VIEW_ZX:
-				case Mode::VIEW_ZY: {
-					relHeight = relativeHeight(1);
-					break;
-				}
-				default:
-					throw std::runtime_error("Incorrect mode");
-			}
-
-			const auto color1 = cv::Scalar(255, 255, 0);
-			const auto color2 = cv::Scalar(0, 255, 255);
-			cv::line(image, from, to, relHeight * color1 + (1.0f - relHeight) * color2, mLineThickness, cv::LINE_AA);
-		}
+		auto image           = mTrajectoryLayer.clone();
+		const auto &poseMask = mPoseMask;
+		const int gridSpan   = mGridSpan; // [cm]
 
 		auto vec3toVec4 = [](const Eigen::Vector3f &vec) {
 			return Eigen::Vector4f(vec.x(), vec.y(), vec.z(), 1.0);
@@ -716,6 +820,8 @@ public:
 		mTrajectory.clear();
 
 		initMinMax();
+		mPendingPoints = 0;
+		mViewDirty     = true;
 	}
 
 	/**
@@ -732,6 +838,7 @@ public:
 	 */
 	void setBackgroundColor(const cv::Scalar &backgroundColor) {
 		PoseVisualizer::mBackgroundColor = backgroundColor;
+		mViewDirty                       = true;
 	}
 
 	/**
@@ -748,6 +855,7 @@ public:
 	 */
 	void setGridColor(const cv::Scalar &gridColor) {
 		PoseVisualizer::mGridColor = gridColor;
+		mViewDirty                 = true;
 	}
 
 	/**
@@ -767,6 +875,28 @@ public:
 		mDrawLinesToMarker = drawLinesToLandmarks;
 	}
 
+	/**
+	 * Get the bounds headroom.
+	 * @return 		Fraction of the span by which the bounds are extended beyond a position that exceeds them.
+	 */
+	[[nodiscard]] float getBoundsHeadroom() const {
+		return mBoundsHeadroom;
+	}
+
+	/**
+	 * Set the bounds headroom. The view is fitted to the bounds of the trajectory and the whole scene is redrawn
+	 * whenever the bounds change. A trajectory that keeps exploring new space extends the bounds on almost every
+	 * pose, with headroom a bound is extended beyond the new position by the given fraction of the span, so the
+	 * view changes less often at the cost of a less tight fit. Disabled (zero) by default.
+	 * @param headroom 		Fraction of the span, non-negative.
+	 */
+	void setBoundsHeadroom(const float headroom) {
+		if (headroom < 0.f) {
+			throw std::invalid_argument("Bounds headroom must be non-negative.");
+		}
+		mBoundsHeadroom = headroom;
+	}
+
 	/**
 	 * Get the maximum number of landmarks to be drawn.
 	 * @return 		Maximum number of landmarks
@@ -0,0 +1,96 @@
+#include <dv-processing/data/generate.hpp>
+#include <dv-processing/features/event_blob_detector.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+
+// Synthetic scene: a few dense event clusters on top of uniformly distributed background noise
+namespace {
+
+const cv::Size resolution(640, 480);
+const size_t iterations       = 100;
+const size_t backgroundEvents = 20'000;
+const size_t clusterEvents    = 1'000;
+const float matchDistance     = 5.f;
+
+std::vector<dv::Point2f> clusterCenters(std::mt19937 &rng) {
+    std::uniform_real_distribution<float> x(20.f, static_cast<float>(resolution.width) - 20.f);
+    std::uniform_real_distribution<float> y(20.f, static_cast<float>(resolution.height) - 20.f);
+    std::vector<dv::Point2f> centers;
+    for (size_t i = 0; i < 5; i++) {
+        centers.emplace_back(x(rng), y(rng));
+    }
+    return centers;
+}
+
+dv::EventStore generateScene(const std::vector<dv::Point2f> &centers, const uint64_t seed) {
+    dv::EventStore events = dv::data::generate::uniformlyDistributedEvents(0, resolution, backgroundEvents, seed);
+    for (const auto &center : centers) {
+        for (const auto &event : dv::data::generate::normallyDistributedEvents(
+                 0, center, dv::Point2f(3.f, 3.f), clusterEvents, seed + 1)) {
+            if (event.x() >= 0 && event.y() >= 0 && event.x() < resolution.width && event.y() < resolution.height) {
+                events.push_back(event);
+            }
+        }
+    }
+    return events;
+}
+
+struct Statistics {
+    double totalMicroseconds = 0.0;
+    size_t detections        = 0;
+    size_t matchedClusters   = 0;
+    size_t clusters          = 0;
+};
+
+// Measures detection latency and how many of the known clusters are found by the detector
+Statistics runBenchmark(dv::features::EventBlobDetector &detector) {
+    Statistics stats;
+    std::mt19937 rng(0);
+
+    for (size_t iteration = 0; iteration < iterations; iteration++) {
+        const auto centers = clusterCenters(rng);
+        const auto events  = generateScene(centers, iteration);
+
+        const auto start = std::chrono::high_resolution_clock::now();
+        const auto blobs = detector.detect(events);
+        const auto end   = std::chrono::high_resolution_clock::now();
+
+        stats.totalMicroseconds += std::chrono::duration<double, std::micro>(end - start).count();
+        stats.detections        += blobs.size();
+        stats.clusters          += centers.size();
+        for (const auto &center : centers) {
+            for (const auto &blob : blobs) {
+                if (std::hypot(blob.pt.x() - center.x(), blob.pt.y() - center.y()) < matchDistance) {
+                    stats.matchedClusters++;
+                    break;
+                }
+            }
+        }
+    }
+
+    return stats;
+}
+
+void printStatistics(const std::string &name, const Statistics &stats) {
+    std::cout << name << ": mean latency " << stats.totalMicroseconds / static_cast<double>(iterations)
+              << " us, found " << stats.matchedClusters << " of " << stats.clusters << " clusters, "
+              << stats.detections << " detections" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    for (int pyramidLevel = 0; pyramidLevel <= 2; pyramidLevel++) {
+        dv::features::EventBlobDetector accumulated(resolution, pyramidLevel);
+        dv::features::EventBlobDetector occupancy(
+            resolution, pyramidLevel, dv::features::EventBlobDetector::OccupancyGridParams());
+
+        const std::string level = " (pyramid level " + std::to_string(pyramidLevel) + ")";
+        printStatistics("Accumulated image" + level, runBenchmark(accumulated));
+        printStatistics("Occupancy grid" + level, runBenchmark(occupancy));
+    }
+
+    return 0;
+}
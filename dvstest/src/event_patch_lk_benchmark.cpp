@@ -0,0 +1,155 @@
+#include <dv-processing/features/event_feature_lk_tracker.hpp>
+#include <dv-processing/features/event_patch_lk_tracker.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+
+// Synthetic sparse scene: a few squares moving with a constant velocity, events are generated on square edges
+namespace {
+
+const cv::Size resolution(346, 260);
+const cv::Point2f velocity(120.f, 60.f); // pixels per second
+const int64_t duration       = 3000000;
+const int64_t batchDuration  = 1000;
+const size_t eventsPerSquare = 40;
+const float squareSize       = 20.f;
+
+std::vector<cv::Point2f> squareOrigins() {
+    std::vector<cv::Point2f> origins;
+    for (float y = 30.f; y < 100.f; y += 50.f) {
+        for (float x = 30.f; x < 200.f; x += 60.f) {
+            origins.emplace_back(x, y);
+        }
+    }
+    return origins;
+}
+
+dv::EventStore generateBatch(const int64_t timestamp, const std::vector<cv::Point2f> &origins, std::mt19937 &rng) {
+    std::uniform_real_distribution<float> along(0.f, squareSize);
+    std::uniform_int_distribution<int> side(0, 3);
+    std::uniform_int_distribution<int64_t> jitter(0, batchDuration - 1);
+
+    const cv::Point2f shift = velocity * (static_cast<float>(timestamp) * 1e-6f);
+
+    std::vector<std::pair<int64_t, cv::Point2f>> events;
+    for (const auto &origin : origins) {
+        for (size_t i = 0; i < eventsPerSquare; i++) {
+            const float offset = along(rng);
+            cv::Point2f point  = origin + shift;
+            switch (side(rng)) {
+                case 0:
+                    point += cv::Point2f(offset, 0.f);
+                    break;
+                case 1:
+                    point += cv::Point2f(offset, squareSize);
+                    break;
+                case 2:
+                    point += cv::Point2f(0.f, offset);
+                    break;
+                default:
+                    point += cv::Point2f(squareSize, offset);
+                    break;
+            }
+            events.emplace_back(timestamp + jitter(rng), point);
+        }
+    }
+    std::sort(events.begin(), events.end(), [](const auto &a, const auto &b) {
+        return a.first < b.first;
+    });
+
+    dv::EventStore store;
+    for (const auto &[time, point] : events) {
+        if (point.x >= 0.f && point.y >= 0.f && point.x < static_cast<float>(resolution.width)
+            && point.y < static_cast<float>(resolution.height)) {
+            store.emplace_back(time, static_cast<int16_t>(point.x), static_cast<int16_t>(point.y), true);
+        }
+    }
+    return store;
+}
+
+struct Statistics {
+    double totalMicroseconds = 0.0;
+    size_t iterations        = 0;
+    double totalError        = 0.0;
+    size_t measurements      = 0;
+};
+
+// Runs the tracker on the same event stream and measures per step latency and the end-point error of the
+// displacement of each successfully tracked feature against the known scene motion
+template<class Tracker>
+Statistics runBenchmark(Tracker &tracker, const std::vector<dv::EventStore> &batches) {
+    Statistics stats;
+    std::map<int, cv::Point2f> previousPositions;
+    int64_t previousTimestamp = 0;
+
+    for (const auto &batch : batches) {
+        tracker.accept(batch);
+
+        while (true) {
+            const auto start  = std::chrono::high_resolution_clock::now();
+            const auto result = tracker.runTracking();
+            const auto end    = std::chrono::high_resolution_clock::now();
+            if (!result) {
+                break;
+            }
+
+            stats.totalMicroseconds += std::chrono::duration<double, std::micro>(end - start).count();
+            stats.iterations++;
+
+            const cv::Point2f expected
+                = velocity * (static_cast<float>(result->timestamp - previousTimestamp) * 1e-6f);
+
+            std::map<int, cv::Point2f> positions;
+            for (const auto &keypoint : result->keypoints) {
+                const cv::Point2f position(keypoint.pt.x(), keypoint.pt.y());
+                if (const auto previous = previousPositions.find(keypoint.class_id);
+                    previous != previousPositions.end()) {
+                    stats.totalError += cv::norm((position - previous->second) - expected);
+                    stats.measurements++;
+                }
+                positions.emplace(keypoint.class_id, position);
+            }
+            previousPositions = std::move(positions);
+            previousTimestamp = result->timestamp;
+        }
+    }
+
+    return stats;
+}
+
+void printStatistics(const std::string &name, const Statistics &stats) {
+    std::cout << name << ": " << stats.iterations << " steps, mean latency "
+              << (stats.iterations > 0 ? stats.totalMicroseconds / static_cast<double>(stats.iterations) : 0.0)
+              << " us, mean displacement error "
+              << (stats.measurements > 0 ? stats.totalError / static_cast<double>(stats.measurements) : 0.0)
+              << " px over " << stats.measurements << " measurements" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    std::mt19937 rng(0);
+    const auto origins = squareOrigins();
+
+    std::vector<dv::EventStore> batches;
+    for (int64_t timestamp = 0; timestamp < duration; timestamp += batchDuration) {
+        batches.push_back(generateBatch(timestamp, origins, rng));
+    }
+
+    const size_t numberOfEvents = origins.size() * eventsPerSquare * 10;
+
+    auto regular = dv::features::EventFeatureLKTracker<>::RegularTracker(resolution);
+    regular->setFramerate(100);
+    regular->setNumberOfEvents(numberOfEvents);
+
+    auto patch = dv::features::EventPatchLKTracker::RegularTracker(resolution);
+    patch->setFramerate(100);
+    patch->setNumberOfEvents(numberOfEvents);
+
+    printStatistics("EventFeatureLKTracker", runBenchmark(*regular, batches));
+    printStatistics("EventPatchLKTracker", runBenchmark(*patch, batches));
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include <dv-processing/features/image_feature_lk_tracker.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <numeric>
+
+// Global allocation counter, every heap allocation of the process goes through these operators
+namespace {
+
+std::atomic<size_t> allocationCount{0};
+
+} // namespace
+
+void *operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void *pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+// Synthetic scene: a random texture translating with a constant velocity
+namespace {
+
+const cv::Size resolution(640, 480);
+const size_t numFrames    = 1000;
+const int64_t framePeriod = 1000;
+const cv::Point2f velocity(0.5f, 0.25f); // pixels per frame
+
+struct Statistics {
+    std::vector<size_t> allocations;
+    std::vector<double> latencies;
+    size_t resultAllocations = 0;
+};
+
+double percentile(std::vector<double> values, const double fraction) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    const auto index = static_cast<size_t>(fraction * static_cast<double>(values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+    return values[index];
+}
+
+// Runs the tracker on the frames and measures heap allocations and latency of each tracking step, the consumer
+// holds the latest result until the next one is produced
+Statistics runBenchmark(const std::vector<dv::Frame> &frames, const bool reuseResults) {
+    auto tracker = dv::features::ImageFeatureLKTracker::RegularTracker(resolution);
+    tracker->setResultReuse(reuseResults);
+
+    Statistics stats;
+    dv::features::TrackerBase::Result::ConstPtr latest;
+    for (const auto &frame : frames) {
+        const size_t before = allocationCount.load(std::memory_order_relaxed);
+        const auto start    = std::chrono::high_resolution_clock::now();
+
+        tracker->accept(frame);
+        auto result = tracker->runTracking();
+
+        const auto end     = std::chrono::high_resolution_clock::now();
+        const size_t after = allocationCount.load(std::memory_order_relaxed);
+
+        stats.allocations.push_back(after - before);
+        stats.latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        latest = std::move(result);
+    }
+    stats.resultAllocations = tracker->getResultAllocationCount();
+
+    return stats;
+}
+
+void printStatistics(const std::string &name, const Statistics &stats) {
+    // Skip the first frames, which include detection and buffer growth
+    const auto steady = std::vector<size_t>(stats.allocations.begin() + 10, stats.allocations.end());
+    const size_t total = std::accumulate(steady.begin(), steady.end(), size_t{0});
+
+    std::cout << name << ": mean " << static_cast<double>(total) / static_cast<double>(steady.size())
+              << " allocations per frame (max " << *std::max_element(steady.begin(), steady.end()) << "), "
+              << stats.resultAllocations << " result objects, latency p50 " << percentile(stats.latencies, 0.5)
+              << " us, p99 " << percentile(stats.latencies, 0.99) << " us" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    cv::Mat texture(resolution.height * 2, resolution.width * 2, CV_8UC1);
+    cv::randu(texture, cv::Scalar(0), cv::Scalar(255));
+    cv::GaussianBlur(texture, texture, cv::Size(5, 5), 1.5);
+
+    std::vector<dv::Frame> frames;
+    for (size_t i = 0; i < numFrames; i++) {
+        const cv::Point2f shift = velocity * static_cast<float>(i % 400);
+        const cv::Rect window(static_cast<int>(shift.x), static_cast<int>(shift.y), resolution.width,
+            resolution.height);
+        frames.emplace_back(static_cast<int64_t>(i) * framePeriod, texture(window).clone());
+    }
+
+    printStatistics("New result per frame", runBenchmark(frames, false));
+    printStatistics("Reused results", runBenchmark(frames, true));
+
+    return 0;
+}